@@ -20,6 +20,49 @@ enum
   IDS_PASSWORD_EMPTY,
   IDS_PASSWORD_NOMATCH,
   IDS_PASSWORD_INVALID,
+  IDS_TCONTAINERLOD,
+  IDS_COMMAND_EXPORTASSET_TITLE,
+  IDS_COMMAND_EXPORTASSET_HELP,
+  IDS_COMMAND_IMPORTASSET_TITLE,
+  IDS_COMMAND_IMPORTASSET_HELP,
+  IDS_INFO_ASSETEXPORTFAILED,
+  IDS_COMMAND_CONTAINERLIBRARY_TITLE,
+  IDS_COMMAND_CONTAINERLIBRARY_HELP,
+  IDS_LIBRARY_RESCAN,
+  IDS_LIBRARY_IMPORT,
+  IDS_LIBRARY_RESCANNED,
+  IDS_LIBRARY_RESULTS,
+  IDS_COMMAND_INSTANCEDUPLICATES_TITLE,
+  IDS_COMMAND_INSTANCEDUPLICATES_HELP,
+  IDS_INFO_INSTANCEDUPLICATES,
+  IDS_COMMAND_MAKEUNIQUE_TITLE,
+  IDS_COMMAND_MAKEUNIQUE_HELP,
+  IDS_STATUS_PROTECTING,
+  IDS_STATUS_UNPROTECTING,
+  IDS_COMMAND_PROFILECONTAINERS_TITLE,
+  IDS_COMMAND_PROFILECONTAINERS_HELP,
+  IDS_STATUS_PROFILING,
+  IDS_INFO_PROFILEDONE,
+  IDS_INFO_PROFILENOCONTAINERS,
+  IDS_COMMAND_UPDATEASSET_TITLE,
+  IDS_COMMAND_UPDATEASSET_HELP,
+  IDS_INFO_UPDATEASSET,
+  IDS_STATUS_BAKINGMOTION,
+  IDS_COMMAND_MEMORYREPORT_TITLE,
+  IDS_COMMAND_MEMORYREPORT_HELP,
+  IDS_MEMORY_REFRESH,
+  IDS_MEMORY_EXPORT,
+  IDS_MEMORY_STATUS,
+  IDS_MEMORY_NAME,
+  IDS_MEMORY_OBJECTS,
+  IDS_MEMORY_TOTAL,
+  IDS_MEMORY_GEOMETRY,  // Same order as MEMORYCOLUMN.
+  IDS_MEMORY_TAGS,
+  IDS_MEMORY_TRACKS,
+  IDS_MEMORY_USERDATA,
+  IDS_MEMORY_MATERIALS,
+  IDS_MEMORY_CONTAINER,
+  IDS_INFO_MEMORYEXPORTFAILED,
 };
 
 #endif // c4d_symbols_H
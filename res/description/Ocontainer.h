@@ -15,6 +15,24 @@ enum
   NRCONTAINER_ICON_CLEAR = 2004,          // BUTTON
   NRCONTAINER_PACKUP = 2005,              // BUTTON
 
+  NRCONTAINER_PROXY_MODE = 2027,          // LONG
+    NRCONTAINER_PROXY_MODE_OFF = 0,
+    NRCONTAINER_PROXY_MODE_BOX = 1,
+    NRCONTAINER_PROXY_MODE_CHILDBOXES = 2,
+    NRCONTAINER_PROXY_MODE_OBJECT = 3,
+  NRCONTAINER_PROXY_OBJECT = 2028,        // LINK
+  NRCONTAINER_LOD_ENABLE = 2029,          // BOOL
+  NRCONTAINER_FREEZE = 2030,              // BUTTON
+  NRCONTAINER_UNFREEZE = 2031,            // BUTTON
+  NRCONTAINER_FREEZE_PERSIST = 2032,      // BOOL
+  NRCONTAINER_SUSPEND = 2033,             // BOOL
+  NRCONTAINER_RENDER_STRIP = 2034,        // BOOL
+  NRCONTAINER_INSTANCE_MASTER = 2036,     // LINK
+  NRCONTAINER_PACK = 2037,                // BUTTON
+  NRCONTAINER_UNPACK = 2038,              // BUTTON
+  NRCONTAINER_MOTION_CACHE = 2039,        // BOOL
+  NRCONTAINER_MOTION_BAKE = 2040,         // BUTTON
+
   NRCONTAINER_INFO = 2020,                // GROUP
   NRCONTAINER_INFO_NAME = 2021,           // STRING
   NRCONTAINER_INFO_VERSION = 2022,        // STRING
@@ -22,8 +40,9 @@ enum
   NRCONTAINER_INFO_AUTHOR = 2024,         // STRING
   NRCONTAINER_INFO_AUTHOR_EMAIL = 2025,   // STRING
   NRCONTAINER_INFO_DESCRIPTION = 2026,    // STRING
+  NRCONTAINER_INFO_FINGERPRINT = 2035,    // STRING, read-only
 
-  // Next ID: 2027
+  // Next ID: 2041
 };
 
 #endif // Ocontainer_H
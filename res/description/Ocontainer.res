@@ -8,12 +8,38 @@ CONTAINER Ocontainer {
     BOOL NRCONTAINER_HIDE_TAGS { DEFAULT 1; }
     BOOL NRCONTAINER_HIDE_MATERIALS { DEFAULT 1; }
     BOOL NRCONTAINER_GENERATOR_CHECKMARK { DEFAULT 1; }
+    LONG NRCONTAINER_PROXY_MODE {
+      CYCLE {
+        NRCONTAINER_PROXY_MODE_OFF;
+        NRCONTAINER_PROXY_MODE_BOX;
+        NRCONTAINER_PROXY_MODE_CHILDBOXES;
+        NRCONTAINER_PROXY_MODE_OBJECT;
+      }
+    }
+    LINK NRCONTAINER_PROXY_OBJECT { ACCEPT { Opolygon; } }
+    BOOL NRCONTAINER_LOD_ENABLE { }
+    BOOL NRCONTAINER_SUSPEND { }
+    BOOL NRCONTAINER_RENDER_STRIP { }
+    LINK NRCONTAINER_INSTANCE_MASTER { ACCEPT { Ocontainer; } }
+    BOOL NRCONTAINER_FREEZE_PERSIST { }
+    BOOL NRCONTAINER_MOTION_CACHE { }
     GROUP {
       COLUMNS 3;
       BUTTON NRCONTAINER_ICON_LOAD { }
       BUTTON NRCONTAINER_ICON_CLEAR { }
       BUTTON NRCONTAINER_PACKUP { }
     }
+    GROUP {
+      COLUMNS 2;
+      BUTTON NRCONTAINER_FREEZE { }
+      BUTTON NRCONTAINER_UNFREEZE { }
+    }
+    GROUP {
+      COLUMNS 2;
+      BUTTON NRCONTAINER_PACK { }
+      BUTTON NRCONTAINER_UNPACK { }
+    }
+    BUTTON NRCONTAINER_MOTION_BAKE { }
   }
   GROUP NRCONTAINER_INFO {
     STRING NRCONTAINER_INFO_NAME { }
@@ -22,5 +48,6 @@ CONTAINER Ocontainer {
     STRING NRCONTAINER_INFO_AUTHOR { }
     STRING NRCONTAINER_INFO_AUTHOR_EMAIL { }
     STRING NRCONTAINER_INFO_DESCRIPTION { CUSTOMGUI MULTISTRING; }
+    STRING NRCONTAINER_INFO_FINGERPRINT { ANIM OFF; }
   }
 }
@@ -0,0 +1,17 @@
+#ifndef Tcontainerlod_H
+#define Tcontainerlod_H
+
+enum
+{
+  Tcontainerlod = 1039505,
+
+  CONTAINERLOD_MODE = 2001,               // LONG
+    CONTAINERLOD_MODE_DISTANCE = 0,
+    CONTAINERLOD_MODE_SCREENSIZE = 1,
+  CONTAINERLOD_DISTANCE = 2002,           // REAL
+  CONTAINERLOD_SCREENSIZE = 2003,         // REAL
+
+  // Next ID: 2004
+};
+
+#endif // Tcontainerlod_H
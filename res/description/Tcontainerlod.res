@@ -0,0 +1,15 @@
+
+CONTAINER Tcontainerlod {
+  NAME Tcontainerlod;
+  INCLUDE Tbase;
+  GROUP ID_TAGPROPERTIES {
+    LONG CONTAINERLOD_MODE {
+      CYCLE {
+        CONTAINERLOD_MODE_DISTANCE;
+        CONTAINERLOD_MODE_SCREENSIZE;
+      }
+    }
+    REAL CONTAINERLOD_DISTANCE { UNIT METER; MIN 0.0; }
+    REAL CONTAINERLOD_SCREENSIZE { UNIT REAL; MIN 0.0; STEP 1.0; }
+  }
+}
@@ -0,0 +1,563 @@
+/// Copyright (C) 2013-2015, Niklas Rosenstein
+/// All rights reserved.
+///
+/// Licensed under the GNU Lesser General Public License.
+///
+/// \file Benchmark.cpp
+///
+/// Micro-benchmarks for the hot paths of the plugin. Only compiled when
+/// `NRCONTAINER_BENCHMARK` is defined. The suite builds a synthetic rig,
+/// times the operations and writes the results to `bench/results.json`
+/// in the plugin directory. The results are compared against the
+/// committed `bench/baseline.json` and flagged if they regressed. The
+/// baseline is never written by a normal run, only when the suite is
+/// started with `-nrcontainer-bench-baseline` instead.
+/// `make bench-check` fails on missing, stale or regressed results.
+///
+/// The suite can be run from the "Container Benchmark" command or
+/// headless with `-nrcontainer-bench [key=value ...]` on the command
+/// line, where the keys are the members of #RigParams. `objects=N` sets
+/// the size of the scene for the GetInfo() hook benchmark.
+
+#ifdef NRCONTAINER_BENCHMARK
+
+#include <c4d.h>
+#include <c4d_apibridge.h>
+#include <Ocontainer.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "ContainerObject.h"
+#include "Utils/Misc.h"
+#include "Utils/JobSystem.h"
+
+enum
+{
+  ID_COMMAND_BENCHMARK = 1039500,
+  BENCHMARK_HYPERFILE_IDENT = 'bnch',
+};
+
+/// Relative slowdown against the baseline that counts as a regression.
+static const Float BENCHMARK_TOLERANCE = 0.15;
+
+/// Absolute slowdown in milliseconds below which differences are noise.
+static const Float BENCHMARK_NOISEFLOOR = 0.05;
+
+/// Receives the results of the timed loops so that the compiler can't
+/// drop them.
+static volatile LONG g_benchmarkSink = 0;
+
+/// ***************************************************************************
+/// Parameters for the synthetic rig generator.
+/// ***************************************************************************
+struct RigParams
+{
+  LONG depth = 4;
+  LONG breadth = 5;
+  LONG tagsPerObject = 2;
+  LONG materials = 8;
+  LONG pointsPerMesh = 512;
+  LONG nestedContainers = 4;
+  LONG iterations = 10;
+  LONG getInfoObjects = 1000000;
+
+  /// Parses a `key=value` pair. Returns false if the key is unknown.
+  Bool Parse(const char* arg)
+  {
+    const char* eq = strchr(arg, '=');
+    if (!eq) return false;
+    const std::string key(arg, eq - arg);
+    const LONG value = (LONG) atol(eq + 1);
+    if (key == "depth") depth = value;
+    else if (key == "breadth") breadth = value;
+    else if (key == "tags") tagsPerObject = value;
+    else if (key == "materials") materials = value;
+    else if (key == "points") pointsPerMesh = value;
+    else if (key == "containers") nestedContainers = value;
+    else if (key == "iterations") iterations = value;
+    else if (key == "objects") getInfoObjects = value;
+    else return false;
+    return true;
+  }
+};
+
+/// ***************************************************************************
+/// The timing result of a single benchmark.
+/// ***************************************************************************
+struct Sample
+{
+  std::string name;
+  Float minMs;
+  Float meanMs;
+  Float baselineMs;
+  Bool regressed;
+};
+
+/// ***************************************************************************
+/// Runs *fn* *iterations* times and records the minimum and mean time.
+/// ***************************************************************************
+template <typename Fn>
+static Sample Measure(const char* name, LONG iterations, Fn&& fn)
+{
+  Sample sample = { name, 0.0, 0.0, -1.0, false };
+  Float total = 0.0;
+  for (LONG i = 0; i < iterations; ++i)
+  {
+    const Float start = GeGetMilliSeconds();
+    fn();
+    const Float delta = GeGetMilliSeconds() - start;
+    total += delta;
+    if (i == 0 || delta < sample.minMs)
+      sample.minMs = delta;
+  }
+  if (iterations > 0)
+    sample.meanMs = total / iterations;
+  return sample;
+}
+
+/// ***************************************************************************
+/// Creates a polygon object with approximately *pointCount* points,
+/// arranged as a strip of quads with pseudo-random positions.
+/// ***************************************************************************
+static BaseObject* BuildMesh(LONG pointCount, Random& rnd)
+{
+  pointCount = (pointCount < 4) ? 4 : pointCount - pointCount % 4;
+  const LONG polyCount = pointCount / 4;
+  PolygonObject* op = PolygonObject::Alloc(pointCount, polyCount);
+  if (!op) return nullptr;
+
+  Vector* points = op->GetPointW();
+  CPolygon* polys = op->GetPolygonW();
+  for (LONG i = 0; i < pointCount; ++i)
+    points[i] = Vector(rnd.Get01(), rnd.Get01(), rnd.Get01()) * 100.0;
+  for (LONG i = 0; i < polyCount; ++i)
+    polys[i] = CPolygon(i * 4, i * 4 + 1, i * 4 + 2, i * 4 + 3);
+  op->Message(MSG_UPDATE);
+  return op;
+}
+
+/// ***************************************************************************
+/// Recursively fills *parent* with the synthetic hierarchy.
+/// ***************************************************************************
+static void BuildLevel(BaseObject* parent, const RigParams& params, LONG level,
+    const std::vector<BaseMaterial*>& materials, Random& rnd, LONG& counter)
+{
+  const Bool leaf = (level + 1 >= params.depth);
+  for (LONG i = 0; i < params.breadth; ++i)
+  {
+    BaseObject* op = leaf ? BuildMesh(params.pointsPerMesh, rnd) : BaseObject::Alloc(Onull);
+    if (!op) return;
+    op->SetName("Node " + LongToString(counter));
+    op->InsertUnderLast(parent);
+
+    for (LONG j = 0; j < params.tagsPerObject; ++j)
+    {
+      if (materials.empty())
+      {
+        op->MakeTag(Tphong);
+        continue;
+      }
+      TextureTag* tag = TextureTag::Alloc();
+      if (!tag) break;
+      tag->SetMaterial(materials[(counter + j) % materials.size()]);
+      op->InsertTag(tag);
+    }
+
+    ++counter;
+    if (!leaf)
+      BuildLevel(op, params, level + 1, materials, rnd, counter);
+  }
+}
+
+/// ***************************************************************************
+/// Builds the synthetic rig into *doc* and returns the root container.
+/// ***************************************************************************
+static BaseObject* BuildRig(BaseDocument* doc, const RigParams& params)
+{
+  std::vector<BaseMaterial*> materials;
+  for (LONG i = 0; i < params.materials; ++i)
+  {
+    BaseMaterial* mat = BaseMaterial::Alloc(Mmaterial);
+    if (!mat) break;
+    mat->SetName("Material " + LongToString(i));
+    doc->InsertMaterial(mat);
+    materials.push_back(mat);
+  }
+
+  BaseObject* root = BaseObject::Alloc(Ocontainer);
+  if (!root) return nullptr;
+  doc->InsertObject(root, nullptr, nullptr);
+
+  Random rnd;
+  rnd.Init(1029700);
+  LONG counter = 0;
+  BuildLevel(root, params, 0, materials, rnd, counter);
+
+  // Convert the first Null-Objects of the rig into protected
+  // Containers to exercise the nested-container code paths.
+  LONG remaining = params.nestedContainers;
+  for (NodeIterator<BaseObject> it(root->GetDown(), root); it && remaining > 0; )
+  {
+    BaseObject* op = *it;
+    ++it;
+    if (op->GetType() != Onull || !op->GetDown()) continue;
+    BaseObject* container = ContainerFromNull(op, nullptr);
+    if (container)
+      ContainerProtect(container, "", "", true);
+    --remaining;
+  }
+
+  doc->ExecutePasses(nullptr, true, true, true, BUILDFLAGS_0);
+  return root;
+}
+
+/// ***************************************************************************
+/// Writes *op* to memory and reads it back into *dest*.
+/// ***************************************************************************
+static Bool HyperFileRoundTrip(BaseObject* op, BaseObject* dest)
+{
+  AutoAlloc<MemoryFileStruct> mfs;
+  if (!mfs) return false;
+  Filename fn;
+  fn.SetMemoryWriteMode(mfs);
+  if (WriteHyperFile(nullptr, op, fn, BENCHMARK_HYPERFILE_IDENT) != FILEERROR_NONE)
+    return false;
+
+  void* data = nullptr;
+  Int size = 0;
+  mfs->GetData(data, size, false);
+  Filename rfn;
+  rfn.SetMemoryReadMode(data, size);
+  return ReadHyperFile(nullptr, dest, rfn, BENCHMARK_HYPERFILE_IDENT, nullptr) == FILEERROR_NONE;
+}
+
+/// ***************************************************************************
+/// Times the same reduction with 1, 2, 4, ... threads up to Cinema 4D's
+/// thread count to show how the job system scales, and checks the
+/// results against a serial run. Each size runs on a private scheduler,
+/// the global one keeps serving the rest of the plugin.
+/// ***************************************************************************
+static Bool RunJobSystemSuite(LONG iterations, std::vector<Sample>& samples)
+{
+  const LONG items = 1 << 22;
+  auto work = [](LONG lo, LONG hi) {
+    UInt64 sum = 0;
+    for (LONG i = lo; i < hi; ++i)
+      sum += ((UInt64) i * 2654435761u) % 1000003;
+    return sum;
+  };
+  auto add = [](UInt64 a, UInt64 b) { return a + b; };
+  const UInt64 expected = work(0, items);
+
+  const LONG maxThreads = std::max<LONG>(1, GeGetCurrentThreadCount());
+  Bool ok = true;
+  for (LONG threads = 1; ok; threads = std::min(threads * 2, maxThreads))
+  {
+    JobSystem system;
+    system.Start(threads - 1);
+    UInt64 result = 0;
+    const std::string name = "ParallelReduce" + std::to_string(threads);
+    samples.push_back(Measure(name.c_str(), iterations, [&]() {
+      result = ParallelReduce<UInt64>(system, 0, items, 4096, 0, work, add);
+    }));
+
+    // Jobs of a cancelled group must not start.
+    std::atomic<LONG> started(0);
+    {
+      JobGroup group(system);
+      group.Cancel();
+      for (LONG i = 0; i < 64; ++i)
+        group.Run([&started]() { started.fetch_add(1); });
+    }
+    if (result != expected || started.load() != 0)
+    {
+      GePrint("Container Benchmark: job system returned wrong results with " +
+        LongToString(threads) + " threads.");
+      ok = false;
+    }
+    if (threads == maxThreads) break;
+  }
+  return ok;
+}
+
+/// ***************************************************************************
+/// Runs all benchmarks on a fresh synthetic rig.
+/// ***************************************************************************
+static Bool RunSuite(const RigParams& params, std::vector<Sample>& samples)
+{
+  AutoAlloc<BaseDocument> doc;
+  if (!doc) return false;
+  BaseObject* root = BuildRig(doc, params);
+  if (!root) return false;
+  const LONG n = params.iterations;
+
+  samples.push_back(Measure("GetDimension", n, [&]() {
+    Vector mp, rad;
+    GetNodeData<ObjectData>(root)->GetDimension(root, &mp, &rad);
+  }));
+
+  samples.push_back(Measure("HideNodes", n, [&]() {
+    ContainerProtect(root, "", "", true);
+    ContainerUnprotect(root, "");
+  }));
+
+  samples.push_back(Measure("HideMaterials", n, [&]() {
+    ContainerHideMaterials(root, true, nullptr);
+    ContainerHideMaterials(root, false, nullptr);
+  }));
+
+  samples.push_back(Measure("HashString", n, [&]() {
+    for (LONG i = 0; i < 100; ++i)
+      HashString("benchmark-password-" + LongToString(i));
+  }));
+
+  if (!RunJobSystemSuite(n, samples)) return false;
+
+  // The icon round-trip uses a standalone container so that the
+  // timing is not dominated by the rig hierarchy.
+  AutoAlloc<BaseObject> iconOp(Ocontainer);
+  AutoAlloc<BaseObject> iconDest(Ocontainer);
+  AutoAlloc<BaseBitmap> icon;
+  if (iconOp && iconDest && icon && icon->Init(256, 256) == IMAGERESULT_OK)
+  {
+    icon->Clear(200, 120, 40);
+    ContainerSetIcon(iconOp, icon);
+    samples.push_back(Measure("IconReadWrite", n, [&]() {
+      HyperFileRoundTrip(iconOp, iconDest);
+    }));
+  }
+
+  samples.push_back(Measure("Container2Null+Null2Container", n, [&]() {
+    BaseObject* null = ContainerToNull(root, doc);
+    if (null)
+      root = ContainerFromNull(null, doc);
+  }));
+
+  if (!root) return false;
+
+  // The GetInfo() hook is installed for every object in the application.
+  // Compare a call through the hook against the original function on a
+  // flat scene in which every 16th object is a Container.
+  std::vector<BaseObject*> objects;
+  objects.reserve(params.getInfoObjects);
+  for (LONG i = 0; i < params.getInfoObjects; ++i)
+  {
+    BaseObject* op = BaseObject::Alloc((i % 16 == 0) ? Ocontainer : Onull);
+    if (!op) break;
+    objects.push_back(op);
+  }
+  samples.push_back(Measure("GetInfoUnhooked", n, [&]() {
+    LONG sum = 0;
+    for (BaseObject* op : objects)
+      sum += _orig_GetInfo(op);
+    g_benchmarkSink = sum;
+  }));
+  samples.push_back(Measure("GetInfoHook", n, [&]() {
+    LONG sum = 0;
+    for (BaseObject* op : objects)
+      sum += op->GetInfo();
+    g_benchmarkSink = sum;
+  }));
+  for (BaseObject* op : objects)
+    BaseObject::Free(op);
+
+  return true;
+}
+
+/// ***************************************************************************
+/// Reads the whole file at *fn* into *out*.
+/// ***************************************************************************
+static Bool ReadTextFile(const Filename& fn, std::string& out)
+{
+  AutoAlloc<BaseFile> file;
+  if (!file || !file->Open(fn, FILEOPEN_READ, FILEDIALOG_NONE)) return false;
+  const Int64 length = file->GetLength();
+  out.resize((size_t) length);
+  if (length > 0 && file->ReadBytes(&out[0], length) != length) return false;
+  return true;
+}
+
+/// ***************************************************************************
+/// Writes *text* to the file at *fn*.
+/// ***************************************************************************
+static Bool WriteTextFile(const Filename& fn, const std::string& text)
+{
+  AutoAlloc<BaseFile> file;
+  if (!file || !file->Open(fn, FILEOPEN_WRITE, FILEDIALOG_NONE)) return false;
+  return file->WriteBytes(text.data(), text.size());
+}
+
+/// ***************************************************************************
+/// Finds the `min_ms` value of benchmark *name* in a results document
+/// written by #FormatResults().
+/// ***************************************************************************
+static Bool FindBaseline(const std::string& json, const std::string& name, Float* out)
+{
+  const size_t pos = json.find("\"" + name + "\"");
+  if (pos == std::string::npos) return false;
+  const size_t key = json.find("\"min_ms\":", pos);
+  if (key == std::string::npos) return false;
+  *out = atof(json.c_str() + key + 9);
+  return true;
+}
+
+/// ***************************************************************************
+/// Formats the rig parameters and samples as a JSON document.
+/// ***************************************************************************
+static std::string FormatResults(const RigParams& params, const std::vector<Sample>& samples)
+{
+  char buf[512];
+  std::string json = "{\n";
+  snprintf(buf, sizeof(buf),
+    "  \"rig\": {\"depth\": %d, \"breadth\": %d, \"tags\": %d, \"materials\": %d, "
+    "\"points\": %d, \"containers\": %d, \"iterations\": %d},\n",
+    (int) params.depth, (int) params.breadth, (int) params.tagsPerObject,
+    (int) params.materials, (int) params.pointsPerMesh,
+    (int) params.nestedContainers, (int) params.iterations);
+  json += buf;
+
+  Bool regression = false;
+  json += "  \"results\": {\n";
+  for (size_t i = 0; i < samples.size(); ++i)
+  {
+    const Sample& s = samples[i];
+    regression = regression || s.regressed;
+    snprintf(buf, sizeof(buf),
+      "    \"%s\": {\"min_ms\": %.4f, \"mean_ms\": %.4f, \"baseline_ms\": %.4f, \"regressed\": %s}%s\n",
+      s.name.c_str(), s.minMs, s.meanMs, s.baselineMs, s.regressed ? "true" : "false",
+      (i + 1 < samples.size()) ? "," : "");
+    json += buf;
+  }
+  json += "  },\n";
+  json += regression ? "  \"regression\": true\n" : "  \"regression\": false\n";
+  json += "}\n";
+  return json;
+}
+
+/// ***************************************************************************
+/// Runs the suite, compares it against the baseline and writes the
+/// results. If *recordBaseline* is true the results replace the baseline
+/// instead. Returns false if the suite failed or a regression was found.
+/// ***************************************************************************
+static Bool RunBenchmark(const RigParams& params, Bool recordBaseline)
+{
+  std::vector<Sample> samples;
+  if (!RunSuite(params, samples))
+  {
+    GePrint("Container Benchmark: suite failed.");
+    return false;
+  }
+
+  const Filename dir = GeGetPluginPath() + "bench";
+  if (!GeFExist(dir, true))
+    GeFCreateDir(dir);
+
+  if (recordBaseline)
+  {
+    if (!WriteTextFile(dir + "baseline.json", FormatResults(params, samples)))
+    {
+      GePrint("Container Benchmark: could not write the baseline.");
+      return false;
+    }
+    GePrint("Container Benchmark: recorded the results as baseline.");
+    return true;
+  }
+
+  std::string baseline;
+  Bool hasBaseline = ReadTextFile(dir + "baseline.json", baseline);
+  if (hasBaseline)
+  {
+    Float unused;
+    hasBaseline = false;
+    for (const Sample& s : samples)
+      hasBaseline = hasBaseline || FindBaseline(baseline, s.name, &unused);
+  }
+  Bool regression = false;
+  for (Sample& s : samples)
+  {
+    if (!hasBaseline) continue;
+    if (!FindBaseline(baseline, s.name, &s.baselineMs))
+    {
+      GePrint("Container Benchmark: " + String(s.name.c_str()) + " has no baseline.");
+      continue;
+    }
+    const Float delta = s.minMs - s.baselineMs;
+    s.regressed = delta > BENCHMARK_NOISEFLOOR && delta > s.baselineMs * BENCHMARK_TOLERANCE;
+    regression = regression || s.regressed;
+    GePrint("Container Benchmark: " + String(s.name.c_str()) + " " +
+      RealToString(s.minMs) + " ms (baseline " + RealToString(s.baselineMs) + " ms)" +
+      (s.regressed ? " REGRESSED" : ""));
+  }
+
+  WriteTextFile(dir + "results.json", FormatResults(params, samples));
+  if (!hasBaseline)
+  {
+    GePrint("Container Benchmark: the baseline has no results, record one with "
+      "-nrcontainer-bench-baseline.");
+    return false;
+  }
+  return !regression;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+class BenchmarkCommand : public CommandData
+{
+public:
+
+  C4D_APIBRIDGE_COMMANDDATA_EXECUTE(doc)
+  {
+    RigParams params;
+    if (RunBenchmark(params, false))
+      MessageDialog("Container Benchmark finished, no regressions.");
+    else
+      MessageDialog("Container Benchmark found regressions or has no baseline, see the console.");
+    return true;
+  }
+
+};
+
+/// ***************************************************************************
+/// Handles the `-nrcontainer-bench` and `-nrcontainer-bench-baseline`
+/// command-line flags.
+/// ***************************************************************************
+void HandleBenchmarkArgs(C4DPL_CommandLineArgs* args)
+{
+  if (!args) return;
+  for (LONG i = 0; i < args->argc; ++i)
+  {
+    if (!args->argv[i]) continue;
+    const Bool recordBaseline = strcmp(args->argv[i], "-nrcontainer-bench-baseline") == 0;
+    if (!recordBaseline && strcmp(args->argv[i], "-nrcontainer-bench") != 0)
+      continue;
+    args->argv[i] = nullptr;
+
+    RigParams params;
+    for (LONG j = i + 1; j < args->argc && args->argv[j]; ++j)
+    {
+      if (!params.Parse(args->argv[j])) break;
+      args->argv[j] = nullptr;
+    }
+    RunBenchmark(params, recordBaseline);
+    break;
+  }
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+Bool RegisterBenchmark()
+{
+  return RegisterCommandPlugin(
+    ID_COMMAND_BENCHMARK,
+    "Container Benchmark"_s,
+    0,
+    nullptr,
+    ""_s,
+    gNew(BenchmarkCommand));
+}
+
+#endif // NRCONTAINER_BENCHMARK
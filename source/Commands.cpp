@@ -17,6 +17,18 @@
 #include <Ocontainer.h>
 #include "res/c4d_symbols.h"
 #include "ContainerObject.h"
+#include "ContainerAsset.h"
+#include "Generated/EmbeddedIcons.h"
+#include "Utils/Misc.h"
+#include "Utils/Trace.h"
+
+#include <customgui_inexclude.h>
+#include <lib_ca.h>
+#include <cstring>
+#include <map>
+#include <set>
+#include <string>
+#include <unordered_map>
 
 using c4d_apibridge::IsEmpty;
 
@@ -24,6 +36,11 @@ enum
 {
   ID_COMMAND_LOADCONTAINER = 1030970,
   ID_COMMAND_CONVERTCONTAINER = 1030971,
+  ID_COMMAND_EXPORTASSET = 1039508,
+  ID_COMMAND_IMPORTASSET = 1039509,
+  ID_COMMAND_INSTANCEDUPLICATES = 1039512,
+  ID_COMMAND_MAKEUNIQUE = 1039513,
+  ID_COMMAND_UPDATEASSET = 1039519,
 };
 
 static Bool GetState(CommandData* dat, BaseDocument* doc, GeDialog* parentManager) {
@@ -215,6 +232,511 @@ static Bool ReplaceObjects(
   return true;
 }
 
+/// ***************************************************************************
+/// ***************************************************************************
+BaseObject* ContainerFromNull(BaseObject* op, BaseDocument* doc)
+{
+  TRACE_SCOPE("Null2Container");
+  if (!op) return nullptr;
+  AliasTrans* at = nullptr; // @FUTURE_EXT_OP
+  BaseObject* root = BaseObject::Alloc(Ocontainer);
+  if (!root) return nullptr;
+
+  BaseContainer* bc = op->GetDataInstance();
+  CriticalAssert(bc != nullptr);
+  String hash = bc->GetString(CONTAINEROBJECT_PROTECTIONHASH);
+  if (!IsEmpty(hash))
+  {
+    ContainerProtect(root, "", hash, false);
+  }
+
+  ReplaceObjects(op, root, doc, at);
+  BaseObject::Free(op);
+  return root;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+BaseObject* ContainerToNull(BaseObject* op, BaseDocument* doc)
+{
+  TRACE_SCOPE("Container2Null");
+  if (!op) return nullptr;
+  AliasTrans* at = nullptr; // @FUTURE_EXT_OP
+  BaseObject* root = BaseObject::Alloc(Onull);
+  if (!root) return nullptr;
+
+  ReplaceObjects(op, root, doc, at);
+  String hash = "";
+  if (ContainerIsProtected(op, &hash))
+  {
+    BaseContainer* bc = root->GetDataInstance();
+    CriticalAssert(bc != nullptr);
+    bc->SetString(CONTAINEROBJECT_PROTECTIONHASH, hash);
+  }
+
+  BaseObject::Free(op);
+  return root;
+}
+
+/// Rough size of an object or tag in a saved scene, without its point,
+/// polygon and variable tag data.
+static const Int64 INSTANCEDUPLICATES_NODEBYTES = 512;
+
+/// ***************************************************************************
+/// Estimates the bytes that *op* and its tags take in a saved scene.
+/// ***************************************************************************
+static Int64 EstimateSavedBytes(BaseObject* op)
+{
+  Int64 bytes = INSTANCEDUPLICATES_NODEBYTES;
+  for (BaseTag* tag = op->GetFirstTag(); tag; tag = tag->GetNext())
+  {
+    bytes += INSTANCEDUPLICATES_NODEBYTES;
+    if (tag->GetInfo() & TAG_VARIABLE)
+    {
+      VariableTag* vtag = static_cast<VariableTag*>(tag);
+      bytes += (Int64) vtag->GetDataCount() * vtag->GetDataSize();
+    }
+  }
+  return bytes;
+}
+
+/// ***************************************************************************
+/// Compares the contents of two Containers node by node. Instancing
+/// deletes the contents of duplicates, so matching fingerprints are
+/// confirmed with this first. Links between the nodes of one Container
+/// must point to the corresponding nodes of the other, links to nodes
+/// outside must point to the same node. Tags whose data can't be seen
+/// (XPresso) never compare equal.
+/// ***************************************************************************
+class ContentCompare
+{
+public:
+
+  ContentCompare(BaseDocument* doc) : m_doc(doc) { }
+
+  Bool Equal(BaseObject* a, BaseObject* b)
+  {
+    m_map.clear();
+    m_pairs.clear();
+    if (!MapChildren(a, b)) return false;
+    for (const auto& pair : m_pairs)
+    {
+      if (!EqualNode(pair.first, pair.second)) return false;
+    }
+    return true;
+  }
+
+private:
+
+  BaseDocument* m_doc;
+  std::unordered_map<BaseList2D*, BaseList2D*> m_map;
+  std::vector<std::pair<BaseList2D*, BaseList2D*>> m_pairs;
+
+  void AddPair(BaseList2D* a, BaseList2D* b)
+  {
+    m_map[a] = b;
+    m_pairs.push_back(std::make_pair(a, b));
+  }
+
+  /// Pairs up the objects and tags below *a* and *b*, which must have
+  /// the same structure and types.
+  Bool MapChildren(BaseObject* a, BaseObject* b)
+  {
+    BaseObject* cb = b->GetDown();
+    for (BaseObject* ca = a->GetDown(); ca; ca = ca->GetNext(), cb = cb->GetNext())
+    {
+      if (!cb || ca->GetType() != cb->GetType()) return false;
+      AddPair(ca, cb);
+      BaseTag* tb = cb->GetFirstTag();
+      for (BaseTag* ta = ca->GetFirstTag(); ta; ta = ta->GetNext(), tb = tb->GetNext())
+      {
+        if (!tb || ta->GetType() != tb->GetType() || ta->GetType() == Texpresso) return false;
+        AddPair(ta, tb);
+      }
+      if (tb || !MapChildren(ca, cb)) return false;
+    }
+    return cb == nullptr;
+  }
+
+  Bool EqualLink(BaseList2D* a, BaseList2D* b)
+  {
+    auto it = m_map.find(a);
+    return it != m_map.end() ? it->second == b : a == b;
+  }
+
+  Bool EqualData(const GeData& a, const GeData& b)
+  {
+    if (a.GetType() != b.GetType()) return false;
+    switch (a.GetType())
+    {
+      case DA_ALIASLINK:
+        return EqualLink(a.GetLink(m_doc), b.GetLink(m_doc));
+      case DA_CONTAINER:
+        return EqualContainer(a.GetContainer(), b.GetContainer());
+      case CUSTOMDATATYPE_INEXCLUDE_LIST:
+      {
+        const InExcludeData* la = static_cast<const InExcludeData*>(
+          a.GetCustomDataType(CUSTOMDATATYPE_INEXCLUDE_LIST));
+        const InExcludeData* lb = static_cast<const InExcludeData*>(
+          b.GetCustomDataType(CUSTOMDATATYPE_INEXCLUDE_LIST));
+        if (!la || !lb) return la == lb;
+        const LONG count = la->GetObjectCount();
+        if (count != lb->GetObjectCount()) return false;
+        for (LONG i = 0; i < count; ++i)
+        {
+          if (la->GetFlags(i) != lb->GetFlags(i)) return false;
+          if (!EqualLink(la->ObjectFromIndex(m_doc, i), lb->ObjectFromIndex(m_doc, i)))
+            return false;
+        }
+        return true;
+      }
+      default:
+        return a == b;
+    }
+  }
+
+  Bool EqualContainer(const BaseContainer* a, const BaseContainer* b)
+  {
+    if (!a || !b) return a == b;
+    LONG count = 0;
+    LONG id;
+    GeData* data;
+    BrowseContainer browse(a);
+    while (browse.GetNext(&id, &data))
+    {
+      const GeData* other = b->GetDataPointer(id);
+      if (!other || !EqualData(*data, *other)) return false;
+      ++count;
+    }
+    BrowseContainer browseB(b);
+    while (browseB.GetNext(&id, &data))
+      --count;
+    return count == 0;
+  }
+
+  Bool EqualTracks(BaseList2D* a, BaseList2D* b)
+  {
+    CTrack* tb = b->GetFirstCTrack();
+    for (CTrack* ta = a->GetFirstCTrack(); ta; ta = ta->GetNext(), tb = tb->GetNext())
+    {
+      if (!tb || ta->GetDescriptionID() != tb->GetDescriptionID()) return false;
+      if (!EqualContainer(ta->GetDataInstance(), tb->GetDataInstance())) return false;
+      CCurve* ca = ta->GetCurve(CCURVE_CURVE, false);
+      CCurve* cb = tb->GetCurve(CCURVE_CURVE, false);
+      const LONG count = ca ? ca->GetKeyCount() : 0;
+      if (count != (cb ? cb->GetKeyCount() : 0)) return false;
+      for (LONG i = 0; i < count; ++i)
+      {
+        const CKey* ka = ca->GetKey(i);
+        const CKey* kb = cb->GetKey(i);
+        if (ka->GetTime() != kb->GetTime() || ka->GetInterpolation() != kb->GetInterpolation()
+            || ka->GetValue() != kb->GetValue() || ka->GetValueLeft() != kb->GetValueLeft()
+            || ka->GetValueRight() != kb->GetValueRight() || ka->GetTimeLeft() != kb->GetTimeLeft()
+            || ka->GetTimeRight() != kb->GetTimeRight() || !EqualData(ka->GetGeData(), kb->GetGeData()))
+          return false;
+      }
+    }
+    return tb == nullptr;
+  }
+
+  /// Compares the data of tags that is not in their container.
+  Bool EqualTagData(BaseTag* a, BaseTag* b)
+  {
+    switch (a->GetType())
+    {
+      case Tuvw:
+      case Tvertexmap:
+      case Tnormal:
+      case Ttangent:
+      case Tsegment:
+      case Tvertexcolor:
+      {
+        VariableTag* va = static_cast<VariableTag*>(a);
+        VariableTag* vb = static_cast<VariableTag*>(b);
+        const LONG count = va->GetDataCount();
+        const LONG size = va->GetDataSize();
+        if (count != vb->GetDataCount() || size != vb->GetDataSize()) return false;
+        const void* da = va->GetLowlevelDataAddressR();
+        const void* db = vb->GetLowlevelDataAddressR();
+        if (!da || !db) return da == db;
+        return std::memcmp(da, db, (size_t) count * size) == 0;
+      }
+      case Tpointselection:
+      case Tpolygonselection:
+      case Tedgeselection:
+      {
+        BaseSelect* sa = static_cast<SelectionTag*>(a)->GetBaseSelect();
+        BaseSelect* sb = static_cast<SelectionTag*>(b)->GetBaseSelect();
+        if (!sa || !sb) return sa == sb;
+        return sa->IsEqual(sb);
+      }
+      case Tweights:
+      {
+        CAWeightTag* wa = static_cast<CAWeightTag*>(a);
+        CAWeightTag* wb = static_cast<CAWeightTag*>(b);
+        const LONG joints = wa->GetJointCount();
+        if (joints != wb->GetJointCount()) return false;
+        for (LONG j = 0; j < joints; ++j)
+        {
+          if (!EqualLink(wa->GetJoint(j, m_doc), wb->GetJoint(j, m_doc))) return false;
+          const LONG count = wa->GetWeightCount(j);
+          if (count != wb->GetWeightCount(j)) return false;
+          for (LONG i = 0; i < count; ++i)
+          {
+            Int32 ia = 0, ib = 0;
+            Float fa = 0.0, fb = 0.0;
+            wa->GetIndexWeight(j, i, ia, fa);
+            wb->GetIndexWeight(j, i, ib, fb);
+            if (ia != ib || fa != fb) return false;
+          }
+        }
+        return true;
+      }
+    }
+    return true;
+  }
+
+  Bool EqualNode(BaseList2D* a, BaseList2D* b)
+  {
+    if (a->GetName() != b->GetName()) return false;
+    if (!EqualContainer(a->GetDataInstance(), b->GetDataInstance())) return false;
+    if (!EqualTracks(a, b)) return false;
+    if (a->IsInstanceOf(Tbase))
+      return EqualTagData(static_cast<BaseTag*>(a), static_cast<BaseTag*>(b));
+
+    BaseObject* oa = static_cast<BaseObject*>(a);
+    BaseObject* ob = static_cast<BaseObject*>(b);
+    if (oa->GetMl() != ob->GetMl()) return false;
+    if (oa->IsInstanceOf(Opoint))
+    {
+      PointObject* pa = static_cast<PointObject*>(oa);
+      PointObject* pb = static_cast<PointObject*>(ob);
+      const LONG count = pa->GetPointCount();
+      if (count != pb->GetPointCount()) return false;
+      if (count > 0 && std::memcmp(pa->GetPointR(), pb->GetPointR(), count * sizeof(Vector)) != 0)
+        return false;
+    }
+    if (oa->IsInstanceOf(Opolygon))
+    {
+      PolygonObject* pa = static_cast<PolygonObject*>(oa);
+      PolygonObject* pb = static_cast<PolygonObject*>(ob);
+      const LONG count = pa->GetPolygonCount();
+      if (count != pb->GetPolygonCount()) return false;
+      if (count > 0 && std::memcmp(pa->GetPolygonR(), pb->GetPolygonR(), count * sizeof(CPolygon)) != 0)
+        return false;
+    }
+    return true;
+  }
+};
+
+/// ***************************************************************************
+/// Maps every object and tag of *doc* that is linked to the objects the
+/// links come from, nullptr for links from materials. The hosts of
+/// XPresso tags, whose references can't be seen, are added to *xpresso*.
+/// ***************************************************************************
+static void CollectReferrers(BaseDocument* doc,
+    std::unordered_map<BaseList2D*, std::vector<BaseObject*>>& referrers,
+    std::vector<BaseObject*>& xpresso)
+{
+  std::set<BaseList2D*> refs;
+  for (NodeIterator<BaseObject> it(doc->GetFirstObject()); it; ++it)
+  {
+    refs.clear();
+    CollectLinks(it->GetDataInstance(), doc, refs);
+    for (BaseTag* tag = it->GetFirstTag(); tag; tag = tag->GetNext())
+    {
+      if (tag->GetType() == Texpresso)
+        xpresso.push_back(*it);
+      CollectLinks(tag->GetDataInstance(), doc, refs);
+    }
+    for (BaseList2D* ref : refs)
+      referrers[ref].push_back(*it);
+  }
+  for (BaseMaterial* mat = doc->GetFirstMaterial(); mat; mat = mat->GetNext())
+  {
+    refs.clear();
+    CollectLinks(mat->GetDataInstance(), doc, refs);
+    for (BaseList2D* ref : refs)
+      referrers[ref].push_back(nullptr);
+  }
+}
+
+/// ***************************************************************************
+/// Returns true if *op* is *root* or below it.
+/// ***************************************************************************
+static Bool IsInHierarchy(BaseObject* op, BaseObject* root)
+{
+  for (; op; op = op->GetUp())
+  {
+    if (op == root) return true;
+  }
+  return false;
+}
+
+/// ***************************************************************************
+/// Returns true if a node outside of *root* may reference one of the
+/// objects or tags below it.
+/// ***************************************************************************
+static Bool IsReferencedFromOutside(BaseObject* root,
+    const std::unordered_map<BaseList2D*, std::vector<BaseObject*>>& referrers,
+    const std::vector<BaseObject*>& xpresso)
+{
+  for (BaseObject* host : xpresso)
+  {
+    if (!IsInHierarchy(host, root)) return true;
+  }
+  auto outside = [&](BaseList2D* node) {
+    auto it = referrers.find(node);
+    if (it == referrers.end()) return false;
+    for (BaseObject* from : it->second)
+    {
+      if (!from || !IsInHierarchy(from, root)) return true;
+    }
+    return false;
+  };
+  for (NodeIterator<BaseObject> it(root->GetDown(), root); it; ++it)
+  {
+    if (outside(*it)) return true;
+    for (BaseTag* tag = it->GetFirstTag(); tag; tag = tag->GetNext())
+    {
+      if (outside(tag)) return true;
+    }
+  }
+  return false;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+LONG ContainerInstanceDuplicates(BaseDocument* doc, LONG* objects, Int64* points, Int64* bytes)
+{
+  TRACE_SCOPE("ContainerInstanceDuplicates");
+  if (objects) *objects = 0;
+  if (points) *points = 0;
+  if (bytes) *bytes = 0;
+  if (!doc) return 0;
+
+  std::vector<ContainerInfo> containers;
+  ContainerFindAll(doc, &containers);
+
+  std::unordered_map<BaseList2D*, std::vector<BaseObject*>> referrers;
+  std::vector<BaseObject*> xpresso;
+  CollectReferrers(doc, referrers, xpresso);
+
+  // Containers come in hierarchy order, so a container is always seen
+  // after its ancestors. Containers inside converted duplicates are
+  // deleted with them and can neither be masters nor duplicates. The
+  // fingerprint only groups the candidates, the contents are compared
+  // before anything is deleted.
+  std::map<std::string, std::vector<BaseObject*>> masters;
+  std::set<BaseObject*> converted;
+  std::vector<std::pair<BaseObject*, BaseObject*>> duplicates;
+  ContentCompare compare(doc);
+  for (const ContainerInfo& info : containers)
+  {
+    if (info.isNull || !info.op->GetDown()) continue;
+    Bool inside = false;
+    for (BaseObject* up = info.op->GetUp(); up && !inside; up = up->GetUp())
+      inside = converted.count(up) != 0;
+    if (inside) continue;
+
+    BaseContainer* bc = info.op->GetDataInstance();
+    if (!bc || bc->GetLink(NRCONTAINER_INSTANCE_MASTER, doc)) continue;
+
+    // A protected Container can only instance a master with the same
+    // protection.
+    Fingerprint fp;
+    String hash;
+    if (!ContainerGetFingerprint(info.op, &fp)) continue;
+    const Bool isProtected = ContainerIsProtected(info.op, &hash);
+    std::string key(reinterpret_cast<const char*>(fp.bytes), sizeof(fp.bytes));
+    key += isProtected ? '1' : '0';
+    if (isProtected)
+    {
+      Char* utf8 = hash.GetCStringCopy(STRINGENCODING_UTF8);
+      if (utf8)
+      {
+        key += utf8;
+        DeleteMem(utf8);
+      }
+    }
+
+    std::vector<BaseObject*>& candidates = masters[key];
+    BaseObject* master = nullptr;
+    for (BaseObject* candidate : candidates)
+    {
+      if (compare.Equal(candidate, info.op))
+      {
+        master = candidate;
+        break;
+      }
+    }
+    if (!master || IsReferencedFromOutside(info.op, referrers, xpresso))
+    {
+      candidates.push_back(info.op);
+      continue;
+    }
+    converted.insert(info.op);
+    duplicates.push_back(std::make_pair(info.op, master));
+  }
+
+  for (auto& dup : duplicates)
+  {
+    BaseObject* op = dup.first;
+    for (NodeIterator<BaseObject> it(op->GetDown(), op); it; ++it)
+    {
+      if (objects) ++*objects;
+      if (points && it->IsInstanceOf(Opoint))
+        *points += static_cast<PointObject*>(*it)->GetPointCount();
+      if (bytes)
+        *bytes += EstimateSavedBytes(*it);
+    }
+
+    doc->AddUndo(UNDOTYPE_CHANGE_SMALL, op);
+    op->GetDataInstance()->SetLink(NRCONTAINER_INSTANCE_MASTER, dup.second);
+    while (BaseObject* child = op->GetDown())
+    {
+      doc->AddUndo(UNDOTYPE_DELETE, child);
+      child->Remove();
+      BaseObject::Free(child);
+    }
+    op->SetDirty(DIRTYFLAGS_DATA);
+  }
+  return (LONG) duplicates.size();
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+Bool ContainerMakeUnique(BaseObject* op, BaseDocument* doc)
+{
+  TRACE_SCOPE("ContainerMakeUnique");
+  if (!op || op->GetType() != Ocontainer) return false;
+  BaseContainer* bc = op->GetDataInstance();
+  BaseObject* master = bc ? static_cast<BaseObject*>(
+    bc->GetLink(NRCONTAINER_INSTANCE_MASTER, doc, Ocontainer)) : nullptr;
+  if (!master) return false;
+
+  // Clone all children at once so links between them are kept.
+  AutoAlloc<AliasTrans> at;
+  if (!at || !at->Init(doc)) return false;
+  for (BaseObject* child = master->GetDown(); child; child = child->GetNext())
+  {
+    BaseObject* clone = static_cast<BaseObject*>(child->GetClone(COPYFLAGS_0, at));
+    if (!clone) return false;
+    clone->InsertUnderLast(op);
+    if (doc) doc->AddUndo(UNDOTYPE_NEW, clone);
+  }
+  at->Translate(true);
+
+  if (doc) doc->AddUndo(UNDOTYPE_CHANGE_SMALL, op);
+  bc->RemoveData(NRCONTAINER_INSTANCE_MASTER);
+  op->SetDirty(DIRTYFLAGS_DATA);
+
+  // The clones come from the master as they are, a protected Container
+  // hides them like the rest of its contents.
+  ContainerHideContents(op, doc);
+  return true;
+}
+
 /// ***************************************************************************
 /// ***************************************************************************
 class Null2ContainerCommand : public CommandData
@@ -224,7 +746,7 @@ public:
   static Bool Register()
   {
     AutoAlloc<BaseBitmap> bmp;
-    bmp->Init(GeGetPluginPath() + "res" + "img" + "null2container.png");
+    InitEmbeddedIcon(bmp, EmbeddedIcons::null2container);
 
     return RegisterCommandPlugin(
       ID_COMMAND_LOADCONTAINER,
@@ -242,20 +764,7 @@ public:
     if (!::GetState(this, doc, C4D_APIBRIDGE_COMMANDDATA_GETPARENTMANAGER())) return false;
 
     BaseObject* op = doc->GetActiveObject();
-    AliasTrans* at = nullptr; // @FUTURE_EXT_OP
-    BaseObject* root = BaseObject::Alloc(Ocontainer);
-    if (!root) return false;
-
-    BaseContainer* bc = op->GetDataInstance();
-    CriticalAssert(bc != nullptr);
-    String hash = bc->GetString(CONTAINEROBJECT_PROTECTIONHASH);
-    if (!IsEmpty(hash))
-    {
-      ContainerProtect(root, "", hash, false);
-    }
-
-    ReplaceObjects(op, root, doc, at);
-    BaseObject::Free(op);
+    if (!ContainerFromNull(op, doc)) return false;
     EventAdd();
     return true;
   }
@@ -279,7 +788,7 @@ public:
   static Bool Register()
   {
     AutoAlloc<BaseBitmap> bmp;
-    bmp->Init(GeGetPluginPath() + "res" + "img" + "container2null.png");
+    InitEmbeddedIcon(bmp, EmbeddedIcons::container2null);
 
     return RegisterCommandPlugin(
       ID_COMMAND_CONVERTCONTAINER,
@@ -297,20 +806,263 @@ public:
     if (!::GetState(this, doc, C4D_APIBRIDGE_COMMANDDATA_GETPARENTMANAGER())) return false;
 
     BaseObject* op = doc->GetActiveObject();
-    AliasTrans* at = nullptr; // @FUTURE_EXT_OP
-    BaseObject* root = BaseObject::Alloc(Onull);
-    if (!root) return false;
+    if (!ContainerToNull(op, doc)) return false;
+    EventAdd();
+    return true;
+  }
+
+  C4D_APIBRIDGE_COMMANDDATA_GETSTATE(doc)
+  {
+    if (!doc) return 0;
+    BaseObject* op = doc->GetActiveObject();
+    if (!op || !op->IsInstanceOf(Ocontainer) || ContainerIsBusy(op)) return 0;
+    return CMD_ENABLED;
+  }
+
+};
+
+/// ***************************************************************************
+/// ***************************************************************************
+class ExportAssetCommand : public CommandData
+{
+public:
+
+  static Bool Register()
+  {
+    return RegisterCommandPlugin(
+      ID_COMMAND_EXPORTASSET,
+      GeLoadString(IDS_COMMAND_EXPORTASSET_TITLE),
+      0,
+      nullptr,
+      GeLoadString(IDS_COMMAND_EXPORTASSET_HELP),
+      gNew(ExportAssetCommand));
+  }
+
+  // CommandData
+
+  C4D_APIBRIDGE_COMMANDDATA_EXECUTE(doc)
+  {
+    if (!::GetState(this, doc, C4D_APIBRIDGE_COMMANDDATA_GETPARENTMANAGER())) return false;
+
+    BaseObject* op = doc->GetActiveObject();
+    Filename fn;
+    fn.SetFile(op->GetName());
+    fn.SetSuffix("c4dcontainer");
+    if (!fn.FileSelect(FILESELECTTYPE_ANYTHING, FILESELECT_SAVE,
+        GeLoadString(IDS_COMMAND_EXPORTASSET_TITLE), "c4dcontainer"_s))
+      return true;
 
-    ReplaceObjects(op, root, doc, at);
-    String hash = "";
-    if (ContainerIsProtected(op, &hash))
+    // Placed copies of the asset are matched against the next version
+    // by these ids, see ContainerAssetUpdate().
+    doc->StartUndo();
+    ContainerAssignNodeIds(op, doc);
+    doc->EndUndo();
+    if (!ContainerAssetExport(op, fn))
     {
-      BaseContainer* bc = root->GetDataInstance();
-      CriticalAssert(bc != nullptr);
-      bc->SetString(CONTAINEROBJECT_PROTECTIONHASH, hash);
+      MessageDialog(GeLoadString(IDS_INFO_ASSETEXPORTFAILED));
+      return false;
     }
+    return true;
+  }
+
+  C4D_APIBRIDGE_COMMANDDATA_GETSTATE(doc)
+  {
+    if (!doc) return 0;
+    BaseObject* op = doc->GetActiveObject();
+    if (!op || !op->IsInstanceOf(Ocontainer)) return 0;
+    return CMD_ENABLED;
+  }
 
-    BaseObject::Free(op);
+};
+
+/// ***************************************************************************
+/// ***************************************************************************
+class ImportAssetCommand : public CommandData
+{
+public:
+
+  static Bool Register()
+  {
+    return RegisterCommandPlugin(
+      ID_COMMAND_IMPORTASSET,
+      GeLoadString(IDS_COMMAND_IMPORTASSET_TITLE),
+      0,
+      nullptr,
+      GeLoadString(IDS_COMMAND_IMPORTASSET_HELP),
+      gNew(ImportAssetCommand));
+  }
+
+  // CommandData
+
+  C4D_APIBRIDGE_COMMANDDATA_EXECUTE(doc)
+  {
+    if (!doc) return false;
+    Filename fn;
+    if (!fn.FileSelect(FILESELECTTYPE_ANYTHING, FILESELECT_LOAD,
+        GeLoadString(IDS_TITLE_LOADSCENEFILE), "c4dcontainer"_s))
+      return true;
+
+    doc->StartUndo();
+    BaseObject* op = ContainerAssetImport(fn, doc);
+    doc->EndUndo();
+    if (!op)
+    {
+      MessageDialog(GeLoadString(IDS_INFO_INVALIDSCENEFILE));
+      return false;
+    }
+    doc->SetActiveObject(op);
+    EventAdd();
+    return true;
+  }
+
+};
+
+/// ***************************************************************************
+/// Updates the selected Containers, or all Containers with the name of
+/// the asset if none are selected, to the version in an asset file.
+/// ***************************************************************************
+class UpdateAssetCommand : public CommandData
+{
+public:
+
+  static Bool Register()
+  {
+    return RegisterCommandPlugin(
+      ID_COMMAND_UPDATEASSET,
+      GeLoadString(IDS_COMMAND_UPDATEASSET_TITLE),
+      0,
+      nullptr,
+      GeLoadString(IDS_COMMAND_UPDATEASSET_HELP),
+      gNew(UpdateAssetCommand));
+  }
+
+  // CommandData
+
+  C4D_APIBRIDGE_COMMANDDATA_EXECUTE(doc)
+  {
+    if (!doc) return false;
+    Filename fn;
+    if (!fn.FileSelect(FILESELECTTYPE_ANYTHING, FILESELECT_LOAD,
+        GeLoadString(IDS_TITLE_LOADSCENEFILE), "c4dcontainer"_s))
+      return true;
+
+    BaseDocument* loaded = ContainerAssetLoad(fn);
+    if (!loaded)
+    {
+      MessageDialog(GeLoadString(IDS_INFO_INVALIDSCENEFILE));
+      return false;
+    }
+    BaseObject* source = loaded->GetFirstObject();
+    const String name = source->GetDataInstance()->GetString(NRCONTAINER_INFO_NAME);
+
+    std::vector<BaseObject*> targets;
+    AutoAlloc<AtomArray> selection;
+    if (selection)
+      doc->GetActiveObjects(selection, GETACTIVEOBJECTFLAGS_0);
+    for (LONG i = 0; selection && i < selection->GetCount(); ++i)
+    {
+      BaseObject* op = static_cast<BaseObject*>(selection->GetIndex(i));
+      if (op->IsInstanceOf(Ocontainer))
+        targets.push_back(op);
+    }
+    if (targets.empty() && !IsEmpty(name))
+    {
+      std::vector<ContainerInfo> containers;
+      ContainerFindAll(doc, &containers);
+      for (const ContainerInfo& info : containers)
+      {
+        if (!info.isNull && info.op->GetDataInstance()->GetString(NRCONTAINER_INFO_NAME) == name)
+          targets.push_back(info.op);
+      }
+    }
+
+    ContainerUpdateStats stats = { 0, 0, 0, 0 };
+    LONG count = 0;
+    doc->StartUndo();
+    for (BaseObject* op : targets)
+    {
+      if (ContainerAssetUpdate(op, source, doc, &stats))
+        ++count;
+    }
+    doc->EndUndo();
+    BaseDocument::Free(loaded);
+    EventAdd();
+
+    MessageDialog(GeLoadString(IDS_INFO_UPDATEASSET, String::IntToString(count),
+      String::IntToString(stats.changed), String::IntToString(stats.added),
+      String::IntToString(stats.removed)));
+    return true;
+  }
+
+};
+
+/// ***************************************************************************
+/// ***************************************************************************
+class InstanceDuplicatesCommand : public CommandData
+{
+public:
+
+  static Bool Register()
+  {
+    return RegisterCommandPlugin(
+      ID_COMMAND_INSTANCEDUPLICATES,
+      GeLoadString(IDS_COMMAND_INSTANCEDUPLICATES_TITLE),
+      0,
+      nullptr,
+      GeLoadString(IDS_COMMAND_INSTANCEDUPLICATES_HELP),
+      gNew(InstanceDuplicatesCommand));
+  }
+
+  // CommandData
+
+  C4D_APIBRIDGE_COMMANDDATA_EXECUTE(doc)
+  {
+    if (!doc) return false;
+    LONG objects = 0;
+    Int64 points = 0;
+    Int64 bytes = 0;
+    doc->StartUndo();
+    const LONG count = ContainerInstanceDuplicates(doc, &objects, &points, &bytes);
+    doc->EndUndo();
+    EventAdd();
+
+    MessageDialog(GeLoadString(IDS_INFO_INSTANCEDUPLICATES,
+      String::IntToString(count), String::IntToString(objects), String::IntToString(points),
+      RealToString(bytes / 1024.0, -1, 1)));
+    return true;
+  }
+
+};
+
+/// ***************************************************************************
+/// ***************************************************************************
+class MakeUniqueCommand : public CommandData
+{
+public:
+
+  static Bool Register()
+  {
+    return RegisterCommandPlugin(
+      ID_COMMAND_MAKEUNIQUE,
+      GeLoadString(IDS_COMMAND_MAKEUNIQUE_TITLE),
+      0,
+      nullptr,
+      GeLoadString(IDS_COMMAND_MAKEUNIQUE_HELP),
+      gNew(MakeUniqueCommand));
+  }
+
+  // CommandData
+
+  C4D_APIBRIDGE_COMMANDDATA_EXECUTE(doc)
+  {
+    if (!doc) return false;
+    AutoAlloc<AtomArray> selection;
+    if (!selection) return false;
+    doc->GetActiveObjects(selection, GETACTIVEOBJECTFLAGS_0);
+
+    const AutoUndo au(doc);
+    for (LONG i = 0; i < selection->GetCount(); ++i)
+      ContainerMakeUnique(static_cast<BaseObject*>(selection->GetIndex(i)), doc);
     EventAdd();
     return true;
   }
@@ -320,6 +1072,8 @@ public:
     if (!doc) return 0;
     BaseObject* op = doc->GetActiveObject();
     if (!op || !op->IsInstanceOf(Ocontainer)) return 0;
+    BaseContainer* bc = op->GetDataInstance();
+    if (!bc || !bc->GetLink(NRCONTAINER_INSTANCE_MASTER, doc)) return 0;
     return CMD_ENABLED;
   }
 
@@ -339,5 +1093,16 @@ Bool RegisterCommands()
     GePrint("Container2Null could not be registered.");
     return false;
   }
+  if (!ExportAssetCommand::Register() || !ImportAssetCommand::Register()
+      || !UpdateAssetCommand::Register())
+  {
+    GePrint("Container asset commands could not be registered.");
+    return false;
+  }
+  if (!InstanceDuplicatesCommand::Register() || !MakeUniqueCommand::Register())
+  {
+    GePrint("Container instancing commands could not be registered.");
+    return false;
+  }
   return true;
 }
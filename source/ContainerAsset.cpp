@@ -0,0 +1,309 @@
+/// Copyright (C) 2013-2015, Niklas Rosenstein
+/// All rights reserved.
+///
+/// Licensed under the GNU Lesser General Public License.
+///
+/// \file ContainerAsset.cpp
+
+#include "ContainerAsset.h"
+#include "ContainerObject.h"
+
+#include <c4d_apibridge.h>
+#include <Ocontainer.h>
+#include "Utils/Compression.h"
+#include "Utils/Misc.h"
+#include "Utils/Trace.h"
+
+#include <cstring>
+#include <set>
+
+static_assert(sizeof(ContainerAssetHeader) % 8 == 0, "header must keep the payload aligned");
+
+/// Upper limit for the compressed and uncompressed payload, larger sizes
+/// in a header are treated as a damaged file.
+static const UInt64 CONTAINERASSET_MAXPAYLOAD = (UInt64) 4 << 30;
+
+/// ***************************************************************************
+/// Copies *str* as UTF-8 into *dest*, truncated to at most *size* - 1
+/// bytes without splitting a multi-byte sequence.
+/// ***************************************************************************
+static void CopyField(char* dest, size_t size, const String& str)
+{
+  std::memset(dest, 0, size);
+  Char* utf8 = str.GetCStringCopy(STRINGENCODING_UTF8);
+  if (!utf8) return;
+  size_t length = std::strlen(utf8);
+  if (length > size - 1)
+  {
+    // Back up over continuation bytes (10xxxxxx) to the lead byte of
+    // the sequence that does not fit.
+    length = size - 1;
+    while (length > 0 && (utf8[length] & 0xC0) == 0x80)
+      --length;
+  }
+  std::memcpy(dest, utf8, length);
+  DeleteMem(utf8);
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+template <size_t N>
+static String ReadField(const char (&field)[N])
+{
+  char buffer[N + 1];
+  std::memcpy(buffer, field, N);
+  buffer[N] = 0;
+  return String(buffer, STRINGENCODING_UTF8);
+}
+
+/// ***************************************************************************
+/// Reads and decompresses the payload described by *header* from *file*.
+/// ***************************************************************************
+static maxon::Result<void> ReadPayload(BaseFile* file, const ContainerAssetHeader& header,
+    maxon::BaseArray<maxon::Char>& scene)
+{
+  iferr_scope;
+  const UInt64 fileSize = (UInt64) file->GetLength();
+  if (header.payloadSize > CONTAINERASSET_MAXPAYLOAD || header.payloadRawSize > CONTAINERASSET_MAXPAYLOAD
+      || header.payloadOffset > fileSize || header.payloadSize > fileSize - header.payloadOffset)
+    return maxon::IoError(MAXON_SOURCE_LOCATION, maxon::Url(), "invalid payload size"_s);
+  maxon::BaseArray<maxon::Char> payload;
+  payload.Resize((Int) header.payloadSize) iferr_return;
+  if (!file->Seek(header.payloadOffset, FILESEEK_START)
+      || file->ReadBytes(payload.GetFirst(), payload.GetCount()) != payload.GetCount())
+    return maxon::IoError(MAXON_SOURCE_LOCATION, maxon::Url(), "truncated payload"_s);
+  Decompress(maxon::ToBlock<const maxon::Char>(payload.GetFirst(), payload.GetCount()), scene) iferr_return;
+  if ((UInt64) scene.GetCount() != header.payloadRawSize)
+    return maxon::IoError(MAXON_SOURCE_LOCATION, maxon::Url(), "payload size mismatch"_s);
+  return maxon::OK;
+}
+
+/// ***************************************************************************
+/// Fills the statistics of *header* and collects the materials used by
+/// texture tags below and on *op*.
+/// ***************************************************************************
+static void CollectStatistics(BaseObject* op, ContainerAssetHeader* header,
+    std::set<BaseMaterial*>& materials)
+{
+  for (NodeIterator<BaseObject> it(op, op); it; ++it)
+  {
+    ++header->objectCount;
+    if (it->IsInstanceOf(Opolygon))
+    {
+      PolygonObject* poly = static_cast<PolygonObject*>(*it);
+      header->pointCount += poly->GetPointCount();
+      header->polygonCount += poly->GetPolygonCount();
+    }
+    for (BaseTag* tag = it->GetFirstTag(); tag; tag = tag->GetNext())
+    {
+      ++header->tagCount;
+      if (tag->GetType() != Ttexture) continue;
+      BaseMaterial* mat = static_cast<TextureTag*>(tag)->GetMaterial();
+      if (mat) materials.insert(mat);
+    }
+  }
+  header->materialCount = (UInt32) materials.size();
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+static void WriteIcon(ContainerAssetHeader* header, const BaseBitmap* icon)
+{
+  if (!icon || icon->GetBw() != 64 || icon->GetBh() != 64) return;
+  BaseBitmap* bmp = const_cast<BaseBitmap*>(icon);
+  BaseBitmap* alpha = bmp->GetInternalChannel();
+  UChar* dest = header->icon;
+  for (LONG y = 0; y < 64; ++y)
+  {
+    for (LONG x = 0; x < 64; ++x, dest += 4)
+    {
+      UInt16 r, g, b, a = 255;
+      bmp->GetPixel(x, y, &r, &g, &b);
+      if (alpha)
+        bmp->GetAlphaPixel(alpha, x, y, &a);
+      dest[0] = (UChar) r; dest[1] = (UChar) g; dest[2] = (UChar) b; dest[3] = (UChar) a;
+    }
+  }
+  header->flags |= CONTAINERASSET_FLAG_ICON;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+Bool ContainerAssetExport(BaseObject* op, const Filename& fn)
+{
+  TRACE_SCOPE("ContainerAssetExport");
+  if (!op || op->GetType() != Ocontainer) return false;
+  BaseDocument* srcDoc = op->GetDocument();
+  BaseContainer* bc = op->GetDataInstance();
+  if (!bc) return false;
+
+  ContainerAssetHeader* header = NewMemClear(ContainerAssetHeader, 1);
+  if (!header) return false;
+  header->magic = CONTAINERASSET_MAGIC;
+  header->version = CONTAINERASSET_VERSION;
+  header->headerSize = sizeof(ContainerAssetHeader);
+
+  String hash;
+  if (ContainerIsProtected(op, &hash))
+  {
+    header->flags |= CONTAINERASSET_FLAG_PROTECTED;
+    CopyField(header->protectionHash, sizeof(header->protectionHash), hash);
+  }
+  CopyField(header->infoName, sizeof(header->infoName), bc->GetString(NRCONTAINER_INFO_NAME));
+  CopyField(header->infoVersion, sizeof(header->infoVersion), bc->GetString(NRCONTAINER_INFO_VERSION));
+  CopyField(header->infoUrl, sizeof(header->infoUrl), bc->GetString(NRCONTAINER_INFO_URL));
+  CopyField(header->infoAuthor, sizeof(header->infoAuthor), bc->GetString(NRCONTAINER_INFO_AUTHOR));
+  CopyField(header->infoAuthorEmail, sizeof(header->infoAuthorEmail), bc->GetString(NRCONTAINER_INFO_AUTHOR_EMAIL));
+  CopyField(header->infoDescription, sizeof(header->infoDescription), bc->GetString(NRCONTAINER_INFO_DESCRIPTION));
+  WriteIcon(header, ContainerGetIcon(op));
+
+  std::set<BaseMaterial*> materials;
+  CollectStatistics(op, header, materials);
+
+  // Clone the container and its materials into a temporary document,
+  // the AliasTrans makes the clones link to each other.
+  Bool ok = false;
+  BaseDocument* tmp = BaseDocument::Alloc();
+  AutoAlloc<AliasTrans> at;
+  AutoAlloc<MemoryFileStruct> mfs;
+  AutoAlloc<BaseFile> file;
+  if (tmp && at && mfs && file && at->Init(srcDoc))
+  {
+    BaseObject* clone = static_cast<BaseObject*>(op->GetClone(COPYFLAGS_0, at));
+    if (clone)
+    {
+      clone->SetMg(Matrix());
+      tmp->InsertObject(clone, nullptr, nullptr);
+      for (BaseMaterial* mat : materials)
+      {
+        BaseMaterial* matClone = static_cast<BaseMaterial*>(mat->GetClone(COPYFLAGS_0, at));
+        if (matClone) tmp->InsertMaterial(matClone);
+      }
+      at->Translate(true);
+
+      Filename mfn;
+      mfn.SetMemoryWriteMode(mfs);
+      if (SaveDocument(tmp, mfn, SAVEDOCUMENTFLAGS_DONTADDTORECENTLIST, FORMAT_C4DEXPORT))
+      {
+        void* data = nullptr;
+        Int size = 0;
+        mfs->GetData(data, size, false);
+        maxon::BaseArray<maxon::Char> payload;
+        iferr (Compress(maxon::ToBlock<const maxon::Char>((const maxon::Char*) data, size), payload))
+          payload.Reset();
+        if (data && !payload.IsEmpty())
+        {
+          header->payloadOffset = sizeof(ContainerAssetHeader);
+          header->payloadSize = payload.GetCount();
+          header->payloadRawSize = size;
+          ok = file->Open(fn, FILEOPEN_WRITE, FILEDIALOG_NONE)
+            && file->WriteBytes(header, sizeof(ContainerAssetHeader))
+            && file->WriteBytes(payload.GetFirst(), payload.GetCount())
+            && file->Close();
+        }
+      }
+    }
+  }
+
+  BaseDocument::Free(tmp);
+  DeleteMem(header);
+  return ok;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+Bool ContainerAssetReadHeader(const Filename& fn, ContainerAssetHeader* header)
+{
+  if (!header) return false;
+  AutoAlloc<BaseFile> file;
+  if (!file || !file->Open(fn, FILEOPEN_READ, FILEDIALOG_NONE)) return false;
+  if (file->ReadBytes(header, sizeof(ContainerAssetHeader)) != sizeof(ContainerAssetHeader))
+    return false;
+  return header->magic == CONTAINERASSET_MAGIC
+    && header->version == CONTAINERASSET_VERSION
+    && header->headerSize == sizeof(ContainerAssetHeader);
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+BaseBitmap* ContainerAssetGetIcon(const ContainerAssetHeader& header)
+{
+  if (!(header.flags & CONTAINERASSET_FLAG_ICON)) return nullptr;
+  BaseBitmap* bmp = BaseBitmap::Alloc();
+  if (!bmp) return nullptr;
+  if (bmp->Init(64, 64, 32) != IMAGERESULT_OK)
+  {
+    BaseBitmap::Free(bmp);
+    return nullptr;
+  }
+  BaseBitmap* alpha = bmp->AddChannel(true, false);
+  const UChar* src = header.icon;
+  for (LONG y = 0; y < 64; ++y)
+  {
+    for (LONG x = 0; x < 64; ++x, src += 4)
+    {
+      bmp->SetPixel(x, y, src[0], src[1], src[2]);
+      if (alpha)
+        bmp->SetAlphaPixel(alpha, x, y, src[3]);
+    }
+  }
+  return bmp;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+BaseDocument* ContainerAssetLoad(const Filename& fn)
+{
+  TRACE_SCOPE("ContainerAssetLoad");
+  ContainerAssetHeader* header = NewMemClear(ContainerAssetHeader, 1);
+  if (!header) return nullptr;
+
+  AutoAlloc<BaseFile> file;
+  maxon::BaseArray<maxon::Char> scene;
+  if (ContainerAssetReadHeader(fn, header) && file && file->Open(fn, FILEOPEN_READ, FILEDIALOG_NONE))
+  {
+    iferr (ReadPayload(file, *header, scene))
+      scene.Reset();
+  }
+  DeleteMem(header);
+
+  BaseDocument* loaded = nullptr;
+  if (!scene.IsEmpty())
+  {
+    Filename mfn;
+    mfn.SetMemoryReadMode(scene.GetFirst(), scene.GetCount());
+    loaded = LoadDocument(mfn, SCENEFILTER_OBJECTS | SCENEFILTER_MATERIALS, nullptr);
+  }
+  if (loaded && (!loaded->GetFirstObject() || loaded->GetFirstObject()->GetType() != Ocontainer))
+    BaseDocument::Free(loaded);
+  return loaded;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+BaseObject* ContainerAssetImport(const Filename& fn, BaseDocument* doc)
+{
+  TRACE_SCOPE("ContainerAssetImport");
+  if (!doc) return nullptr;
+
+  // Move the materials and the container into the target document,
+  // the links between them are kept.
+  BaseObject* result = nullptr;
+  BaseDocument* loaded = ContainerAssetLoad(fn);
+  if (loaded)
+  {
+    while (BaseMaterial* mat = loaded->GetFirstMaterial())
+    {
+      mat->Remove();
+      doc->InsertMaterial(mat);
+      doc->AddUndo(UNDOTYPE_NEW, mat);
+    }
+    result = loaded->GetFirstObject();
+    result->Remove();
+    doc->InsertObject(result, nullptr, nullptr);
+    doc->AddUndo(UNDOTYPE_NEW, result);
+  }
+
+  BaseDocument::Free(loaded);
+  return result;
+}
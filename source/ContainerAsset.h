@@ -0,0 +1,126 @@
+/// Copyright (C) 2013-2015, Niklas Rosenstein
+/// All rights reserved.
+///
+/// Licensed under the GNU Lesser General Public License.
+///
+/// \file ContainerAsset.h
+///
+/// The container asset format (`.c4dcontainer`) stores a single
+/// Container with its hierarchy and materials. The file starts with a
+/// #ContainerAssetHeader of fixed size and layout (little endian, no
+/// pointers) that can be read or memory mapped on its own, followed by
+/// the compressed scene as payload at #ContainerAssetHeader::payloadOffset.
+
+#pragma once
+
+#include <c4d.h>
+#include <c4d_legacy.h>
+
+enum
+{
+  /// Int64 in the data container of every node of an exported Container
+  /// that identifies it across versions of the asset.
+  CONTAINERASSET_NODEID = 1039518,
+
+  CONTAINERASSET_MAGIC = 0x4143524E,  // "NRCA"
+  CONTAINERASSET_VERSION = 1,
+
+  CONTAINERASSET_FLAG_PROTECTED = (1 << 0),
+  CONTAINERASSET_FLAG_ICON = (1 << 1),
+};
+
+#pragma pack(push, 1)
+/// ***************************************************************************
+/// The header of a container asset file. Strings are NUL terminated
+/// UTF-8 and truncated to their field size, the icon is 64x64 RGBA.
+/// ***************************************************************************
+struct ContainerAssetHeader
+{
+  UInt32 magic;
+  UInt32 version;
+  UInt32 headerSize;
+  UInt32 flags;
+
+  char protectionHash[72];
+  char infoName[128];
+  char infoVersion[32];
+  char infoUrl[256];
+  char infoAuthor[128];
+  char infoAuthorEmail[128];
+  char infoDescription[1024];
+
+  UInt32 objectCount;
+  UInt32 tagCount;
+  UInt32 materialCount;
+  UInt32 pointCount;
+  UInt32 polygonCount;
+  UInt32 reserved[7];
+
+  UChar icon[64 * 64 * 4];
+
+  UInt64 payloadOffset;
+  UInt64 payloadSize;     ///< Compressed size in bytes.
+  UInt64 payloadRawSize;  ///< Size of the uncompressed scene in bytes.
+};
+#pragma pack(pop)
+
+/// ***************************************************************************
+/// Writes the Container *op* with its children and used materials to *fn*.
+/// *op* is not modified, call ContainerAssignNodeIds() first so placed
+/// copies can be updated from the next version of the file.
+/// ***************************************************************************
+Bool ContainerAssetExport(BaseObject* op, const Filename& fn);
+
+/// ***************************************************************************
+/// Reads only the header of the asset file *fn*. Returns false if the
+/// file is not a container asset or has an unsupported version.
+/// ***************************************************************************
+Bool ContainerAssetReadHeader(const Filename& fn, ContainerAssetHeader* header);
+
+/// ***************************************************************************
+/// Creates a bitmap from the icon stored in *header*, \c nullptr if the
+/// header has no icon. The caller owns the bitmap.
+/// ***************************************************************************
+BaseBitmap* ContainerAssetGetIcon(const ContainerAssetHeader& header);
+
+/// ***************************************************************************
+/// Loads the asset *fn* into *doc* and returns the inserted Container.
+/// Undos are added to *doc*.
+/// ***************************************************************************
+BaseObject* ContainerAssetImport(const Filename& fn, BaseDocument* doc);
+
+/// ***************************************************************************
+/// Loads the scene stored in the asset *fn* into a new document whose
+/// first object is the Container. The caller owns the document.
+/// ***************************************************************************
+BaseDocument* ContainerAssetLoad(const Filename& fn);
+
+/// ***************************************************************************
+/// Gives every object and tag below *op* a #CONTAINERASSET_NODEID that
+/// is unique within the Container. Existing ids are kept. Undos for the
+/// changed nodes are added to *doc* if it is not \c nullptr, the caller
+/// must have called StartUndo(). Returns true if any id was assigned.
+/// ***************************************************************************
+Bool ContainerAssignNodeIds(BaseObject* op, BaseDocument* doc);
+
+/// ***************************************************************************
+/// Counts of what ContainerAssetUpdate() changed.
+/// ***************************************************************************
+struct ContainerUpdateStats
+{
+  LONG changed;     ///< Nodes with at least one changed value.
+  LONG parameters;  ///< Changed parameter values.
+  LONG added;       ///< New nodes and branches.
+  LONG removed;     ///< Nodes that are no longer part of the asset.
+};
+
+/// ***************************************************************************
+/// Updates the placed Container *op* in place to the contents of the
+/// Container *source*, usually the first object of a document loaded
+/// with ContainerAssetLoad(). Nodes are matched by #CONTAINERASSET_NODEID,
+/// or by their position in the hierarchy if they have none, and only
+/// what differs is written. Matched nodes keep their animation and the
+/// links pointing to them. Undos are added to *doc*.
+/// ***************************************************************************
+Bool ContainerAssetUpdate(BaseObject* op, BaseObject* source, BaseDocument* doc,
+  ContainerUpdateStats* stats=nullptr);
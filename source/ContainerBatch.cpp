@@ -0,0 +1,129 @@
+/// Copyright (C) 2013-2015, Niklas Rosenstein
+/// All rights reserved.
+///
+/// Licensed under the GNU Lesser General Public License.
+///
+/// \file ContainerBatch.cpp
+///
+/// Bulk queries over all Containers of a document for pipeline scripts.
+/// The results are written into preallocated parallel arrays so that
+/// thousands of Containers can be audited without a call (and an
+/// allocation) per object and parameter.
+
+#include <c4d.h>
+#include <c4d_apibridge.h>
+#include <Ocontainer.h>
+#include "ContainerObject.h"
+#include "Utils/Misc.h"
+#include "Utils/Trace.h"
+#include "Utils/JobSystem.h"
+
+#include <cstring>
+
+static const LONG g_infoIds[CONTAINERBATCH_INFOCOUNT] = {
+  NRCONTAINER_INFO_NAME,
+  NRCONTAINER_INFO_VERSION,
+  NRCONTAINER_INFO_URL,
+  NRCONTAINER_INFO_AUTHOR,
+  NRCONTAINER_INFO_AUTHOR_EMAIL,
+  NRCONTAINER_INFO_DESCRIPTION,
+};
+
+/// ***************************************************************************
+/// Appends *str* to *out* as a null-terminated UTF-8 string.
+/// ***************************************************************************
+static void AppendString(const String& str, std::vector<Char>& out)
+{
+  const Int len = str.GetCStringLen(STRINGENCODING_UTF8);
+  const size_t pos = out.size();
+  out.resize(pos + len + 1);
+  if (len > 0)
+    str.GetCString(&out[pos], len + 1, STRINGENCODING_UTF8);
+  out[pos + len] = '\0';
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+LONG ContainerQueryBatch(BaseDocument* doc, ContainerBatch* out, LONG fields)
+{
+  if (!doc || !out) return 0;
+  TRACE_SCOPE("ContainerQueryBatch");
+
+  std::vector<ContainerInfo> containers;
+  ContainerFindAll(doc, &containers);
+  out->objects.clear();
+  for (const ContainerInfo& info : containers)
+  {
+    if (!info.isNull)
+      out->objects.push_back(info.op);
+  }
+  const LONG count = (LONG) out->objects.size();
+  out->count = count;
+
+  auto size = [fields](LONG field, size_t n) { return (fields & field) ? n : 0; };
+  out->bounds.resize(size(CONTAINERBATCH_BOUNDS, count * 6));
+  out->isProtected.resize(size(CONTAINERBATCH_PROTECTION, count));
+  out->fingerprints.resize(size(CONTAINERBATCH_FINGERPRINT, count * 32));
+  out->objectCounts.resize(size(CONTAINERBATCH_COUNTS, count));
+  out->tagCounts.resize(size(CONTAINERBATCH_COUNTS, count));
+  out->pointCounts.resize(size(CONTAINERBATCH_COUNTS, count));
+  out->stringOffsets.resize(size(CONTAINERBATCH_INFO, count * CONTAINERBATCH_INFOCOUNT));
+  out->strings.clear();
+
+  // The hierarchy walks only read the scene and run in parallel. The
+  // fingerprint caches are not thread-safe, everything else is cheap.
+  if (fields & CONTAINERBATCH_COUNTS)
+  {
+    ParallelFor(0, count, 1, [out](LONG i) {
+      BaseObject* op = out->objects[i];
+      Int32 objects = 0, tags = 0;
+      Int64 points = 0;
+      for (BaseObject* node = op->GetDown(); node; node = GetNextNode(node, op))
+      {
+        ++objects;
+        for (BaseTag* tag = node->GetFirstTag(); tag; tag = tag->GetNext())
+          ++tags;
+        if (node->IsInstanceOf(Opoint))
+          points += ToPoint(node)->GetPointCount();
+      }
+      out->objectCounts[i] = objects;
+      out->tagCounts[i] = tags;
+      out->pointCounts[i] = points;
+    });
+  }
+
+  for (LONG i = 0; i < count; ++i)
+  {
+    BaseObject* op = out->objects[i];
+    if (fields & CONTAINERBATCH_BOUNDS)
+    {
+      Vector bbmin(0.0), bbmax(0.0);
+      ContainerGetWorldBounds(op, &bbmin, &bbmax);
+      Float* b = &out->bounds[i * 6];
+      b[0] = bbmin.x; b[1] = bbmin.y; b[2] = bbmin.z;
+      b[3] = bbmax.x; b[4] = bbmax.y; b[5] = bbmax.z;
+    }
+    if (fields & CONTAINERBATCH_PROTECTION)
+      out->isProtected[i] = ContainerIsProtected(op) ? 1 : 0;
+    if (fields & CONTAINERBATCH_FINGERPRINT)
+    {
+      Fingerprint fp;
+      ContainerGetFingerprint(op, &fp);
+      std::memcpy(&out->fingerprints[i * 32], fp.bytes, sizeof(fp.bytes));
+    }
+    if (fields & CONTAINERBATCH_INFO)
+    {
+      const BaseContainer* bc = op->GetDataInstance();
+      for (LONG j = 0; j < CONTAINERBATCH_INFOCOUNT; ++j)
+      {
+        out->stringOffsets[i * CONTAINERBATCH_INFOCOUNT + j] = (Int32) out->strings.size();
+        const GeData* data = bc ? bc->GetDataPointer(g_infoIds[j]) : nullptr;
+        if (data && data->GetType() == DA_STRING)
+          AppendString(data->GetString(), out->strings);
+        else
+          out->strings.push_back('\0');
+      }
+    }
+  }
+  return count;
+}
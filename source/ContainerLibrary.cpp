@@ -0,0 +1,725 @@
+/// Copyright (C) 2013-2015, Niklas Rosenstein
+/// All rights reserved.
+///
+/// Licensed under the GNU Lesser General Public License.
+///
+/// \file ContainerLibrary.cpp
+///
+/// Layout of the index file (all integers little endian, see BaseFile):
+///
+///     Int32 magic, Int32 version, Int64 thumbsStart, Int32 entryCount
+///     entryCount * { String path, Int64 mtime, Int64 size, String name,
+///                    String version, String author, String description,
+///                    Int32 thumbSlot, Int32 valid }
+///     Int32 termCount
+///     termCount * { String term, Int32 count, count * Int32 entry }
+///     thumbnail table at thumbsStart, THUMBSIZE^2 RGBA bytes per slot
+
+#include "ContainerLibrary.h"
+#include "ContainerAsset.h"
+#include "ContainerObject.h"
+#include "res/c4d_symbols.h"
+#include "Utils/Trace.h"
+
+#include <c4d_apibridge.h>
+#include <algorithm>
+#include <cctype>
+#include <unordered_map>
+
+enum
+{
+  CONTAINERLIBRARY_MAGIC = 0x4C43524E,  // "NRCL"
+  CONTAINERLIBRARY_VERSION = 2,
+
+  /// World plugin container with the last used library directory.
+  CONTAINERLIBRARY_PREFS = 1039511,
+  CONTAINERLIBRARY_PREFS_DIRECTORY = 1000,
+
+  ID_COMMAND_CONTAINERLIBRARY = 1039510,
+};
+
+static const LONG THUMBBYTES = ContainerLibrary::THUMBSIZE * ContainerLibrary::THUMBSIZE * 4;
+
+/// ***************************************************************************
+/// ***************************************************************************
+static std::string ToUtf8(const String& str)
+{
+  std::string result;
+  Char* utf8 = str.GetCStringCopy(STRINGENCODING_UTF8);
+  if (utf8)
+  {
+    result = utf8;
+    DeleteMem(utf8);
+  }
+  return result;
+}
+
+/// ***************************************************************************
+/// Splits *str* into lower case words. Bytes outside of ASCII are kept
+/// as part of words so that non-latin text can be searched as well.
+/// ***************************************************************************
+static void Tokenize(const String& str, std::vector<std::string>& out)
+{
+  const std::string utf8 = ToUtf8(str);
+  std::string word;
+  for (unsigned char c : utf8)
+  {
+    if (c >= 0x80 || std::isalnum(c))
+      word += (char) std::tolower(c);
+    else if (!word.empty())
+    {
+      out.push_back(word);
+      word.clear();
+    }
+  }
+  if (!word.empty())
+    out.push_back(word);
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+static UInt64 PackFileTime(const LocalFileTime& t)
+{
+  return ((((((UInt64) t.year * 16 + t.month) * 32 + t.day) * 32 + t.hour) * 64
+    + t.minute) * 64) + t.second;
+}
+
+/// ***************************************************************************
+/// Box filters the 64x64 icon of *header* down to a thumbnail.
+/// ***************************************************************************
+static void MakeThumbnail(const ContainerAssetHeader& header, std::vector<UChar>& out)
+{
+  const LONG size = ContainerLibrary::THUMBSIZE;
+  const LONG step = 64 / size;
+  out.assign(THUMBBYTES, 0);
+  for (LONG y = 0; y < size; ++y)
+  {
+    for (LONG x = 0; x < size; ++x)
+    {
+      for (LONG c = 0; c < 4; ++c)
+      {
+        LONG sum = 0;
+        for (LONG dy = 0; dy < step; ++dy)
+          for (LONG dx = 0; dx < step; ++dx)
+            sum += header.icon[((y * step + dy) * 64 + x * step + dx) * 4 + c];
+        out[(y * size + x) * 4 + c] = (UChar) (sum / (step * step));
+      }
+    }
+  }
+}
+
+/// ***************************************************************************
+/// Appends all container assets in *dir* and its sub-directories to *out*.
+/// ***************************************************************************
+static void FindAssets(const Filename& dir, std::vector<ContainerLibrary::Entry>& out)
+{
+  AutoAlloc<BrowseFiles> bf;
+  if (!bf) return;
+  bf->Init(dir, BROWSEFILES_0);
+  while (bf->GetNext())
+  {
+    const Filename fn = dir + bf->GetFilename();
+    if (bf->IsDir())
+    {
+      FindAssets(fn, out);
+      continue;
+    }
+    if (!fn.CheckSuffix("c4dcontainer"_s)) continue;
+    LocalFileTime t;
+    bf->GetFileTime(FILETIME_MODIFIED, &t);
+    ContainerLibrary::Entry entry;
+    entry.path = fn;
+    entry.mtime = PackFileTime(t);
+    entry.size = bf->GetSize();
+    entry.thumbSlot = -1;
+    entry.valid = false;
+    out.push_back(entry);
+  }
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+Bool ContainerLibrary::Open(const Filename& dir)
+{
+  m_dir = dir;
+  m_indexFile = dir + ".containerindex";
+  m_entries.clear();
+  m_pending.clear();
+  m_terms.clear();
+  m_thumbsStart = 0;
+  return Load();
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+Bool ContainerLibrary::Load()
+{
+  TRACE_SCOPE("ContainerLibrary::Load");
+  AutoAlloc<BaseFile> file;
+  if (!file || !GeFExist(m_indexFile) || !file->Open(m_indexFile, FILEOPEN_READ, FILEDIALOG_NONE))
+    return false;
+
+  Int32 magic = 0, version = 0, count = 0;
+  if (!file->ReadInt32(&magic) || magic != CONTAINERLIBRARY_MAGIC) return false;
+  if (!file->ReadInt32(&version) || version != CONTAINERLIBRARY_VERSION) return false;
+  if (!file->ReadInt64(&m_thumbsStart)) return false;
+  if (!file->ReadInt32(&count)) return false;
+
+  std::vector<Entry> entries(count);
+  for (Entry& entry : entries)
+  {
+    String path;
+    Int64 mtime;
+    Int32 slot, valid;
+    if (!file->ReadString(&path) || !file->ReadInt64(&mtime) || !file->ReadInt64(&entry.size)
+        || !file->ReadString(&entry.name) || !file->ReadString(&entry.version)
+        || !file->ReadString(&entry.author) || !file->ReadString(&entry.description)
+        || !file->ReadInt32(&slot) || !file->ReadInt32(&valid))
+      return false;
+    entry.path = Filename(path);
+    entry.mtime = (UInt64) mtime;
+    entry.thumbSlot = slot;
+    entry.valid = valid != 0;
+  }
+
+  Int32 termCount = 0;
+  if (!file->ReadInt32(&termCount)) return false;
+  std::map<std::string, std::vector<LONG>> terms;
+  for (Int32 i = 0; i < termCount; ++i)
+  {
+    String term;
+    Int32 n = 0;
+    if (!file->ReadString(&term) || !file->ReadInt32(&n)) return false;
+    std::vector<LONG>& ids = terms[ToUtf8(term)];
+    ids.resize(n);
+    for (Int32 j = 0; j < n; ++j)
+    {
+      Int32 id;
+      if (!file->ReadInt32(&id) || id < 0 || id >= count) return false;
+      ids[j] = id;
+    }
+  }
+
+  m_entries.swap(entries);
+  m_terms.swap(terms);
+  return true;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+Bool ContainerLibrary::ReadThumbnail(LONG slot, Thumbnail& out) const
+{
+  AutoAlloc<BaseFile> file;
+  if (slot < 0 || !file || !file->Open(m_indexFile, FILEOPEN_READ, FILEDIALOG_NONE))
+    return false;
+  out.resize(THUMBBYTES);
+  return file->Seek(m_thumbsStart + (Int64) slot * THUMBBYTES, FILESEEK_START)
+    && file->ReadBytes(out.data(), THUMBBYTES) == THUMBBYTES;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+Bool ContainerLibrary::Save()
+{
+  TRACE_SCOPE("ContainerLibrary::Save");
+
+  // Gather all thumbnails first, the old index is replaced below.
+  std::vector<Thumbnail> thumbs;
+  std::vector<LONG> slots(m_entries.size(), -1);
+  for (size_t i = 0; i < m_entries.size(); ++i)
+  {
+    Thumbnail thumb;
+    auto it = m_pending.find((LONG) i);
+    if (it != m_pending.end())
+      thumb = it->second;
+    else if (!ReadThumbnail(m_entries[i].thumbSlot, thumb))
+      continue;
+    slots[i] = (LONG) thumbs.size();
+    thumbs.push_back(thumb);
+  }
+
+  Filename tmpFile = m_indexFile;
+  tmpFile.SetSuffix("tmp"_s);
+  AutoAlloc<BaseFile> file;
+  if (!file || !file->Open(tmpFile, FILEOPEN_WRITE, FILEDIALOG_NONE)) return false;
+
+  Bool ok = file->WriteInt32(CONTAINERLIBRARY_MAGIC) && file->WriteInt32(CONTAINERLIBRARY_VERSION);
+  const Int64 thumbsStartPos = file->GetPosition();
+  ok = ok && file->WriteInt64(0) && file->WriteInt32((Int32) m_entries.size());
+  for (size_t i = 0; ok && i < m_entries.size(); ++i)
+  {
+    const Entry& entry = m_entries[i];
+    ok = file->WriteString(entry.path.GetString()) && file->WriteInt64((Int64) entry.mtime)
+      && file->WriteInt64(entry.size) && file->WriteString(entry.name)
+      && file->WriteString(entry.version) && file->WriteString(entry.author)
+      && file->WriteString(entry.description) && file->WriteInt32(slots[i])
+      && file->WriteInt32(entry.valid ? 1 : 0);
+  }
+  ok = ok && file->WriteInt32((Int32) m_terms.size());
+  for (auto it = m_terms.begin(); ok && it != m_terms.end(); ++it)
+  {
+    ok = file->WriteString(String(it->first.c_str(), STRINGENCODING_UTF8))
+      && file->WriteInt32((Int32) it->second.size());
+    for (LONG id : it->second)
+      ok = ok && file->WriteInt32(id);
+  }
+
+  const Int64 thumbsStart = file->GetPosition();
+  for (const Thumbnail& thumb : thumbs)
+    ok = ok && file->WriteBytes(thumb.data(), THUMBBYTES);
+  ok = ok && file->Seek(thumbsStartPos, FILESEEK_START) && file->WriteInt64(thumbsStart);
+  ok = file->Close() && ok;
+
+  if (!ok || (GeFExist(m_indexFile) && !GeFKill(m_indexFile)) || !GeFRename(tmpFile, m_indexFile))
+  {
+    GeFKill(tmpFile);
+    return false;
+  }
+
+  for (size_t i = 0; i < m_entries.size(); ++i)
+    m_entries[i].thumbSlot = slots[i];
+  m_thumbsStart = thumbsStart;
+  m_pending.clear();
+  return true;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+void ContainerLibrary::BuildIndex()
+{
+  m_terms.clear();
+  std::vector<std::string> words;
+  for (size_t i = 0; i < m_entries.size(); ++i)
+  {
+    const Entry& entry = m_entries[i];
+    words.clear();
+    Tokenize(entry.name, words);
+    Tokenize(entry.version, words);
+    Tokenize(entry.author, words);
+    Tokenize(entry.description, words);
+    for (const std::string& word : words)
+    {
+      std::vector<LONG>& ids = m_terms[word];
+      // Entries are visited in order, so the lists stay sorted.
+      if (ids.empty() || ids.back() != (LONG) i)
+        ids.push_back((LONG) i);
+    }
+  }
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+LONG ContainerLibrary::Rescan()
+{
+  TRACE_SCOPE("ContainerLibrary::Rescan");
+  std::vector<Entry> found;
+  FindAssets(m_dir, found);
+
+  std::unordered_map<std::string, size_t> known;
+  for (size_t i = 0; i < m_entries.size(); ++i)
+    known[ToUtf8(m_entries[i].path.GetString())] = i;
+
+  // Keep the entries of unchanged files, only read the headers of new
+  // and modified ones.
+  std::vector<Entry> entries;
+  std::map<LONG, Thumbnail> pending;
+  ContainerAssetHeader* header = NewMemClear(ContainerAssetHeader, 1);
+  if (!header) return 0;
+  LONG read = 0;
+  for (Entry& entry : found)
+  {
+    auto it = known.find(ToUtf8(entry.path.GetString()));
+    if (it != known.end())
+    {
+      const Entry& old = m_entries[it->second];
+      if (old.mtime == entry.mtime && old.size == entry.size)
+      {
+        auto jt = m_pending.find((LONG) it->second);
+        if (jt != m_pending.end())
+          pending[(LONG) entries.size()] = jt->second;
+        entries.push_back(old);
+        continue;
+      }
+    }
+
+    // Unreadable assets are recorded as well so that they are not read
+    // again until they change.
+    ++read;
+    entry.valid = ContainerAssetReadHeader(entry.path, header);
+    if (!entry.valid)
+    {
+      entries.push_back(entry);
+      continue;
+    }
+    entry.name = String(header->infoName, STRINGENCODING_UTF8);
+    entry.version = String(header->infoVersion, STRINGENCODING_UTF8);
+    entry.author = String(header->infoAuthor, STRINGENCODING_UTF8);
+    entry.description = String(header->infoDescription, STRINGENCODING_UTF8);
+    if (header->flags & CONTAINERASSET_FLAG_ICON)
+      MakeThumbnail(*header, pending[(LONG) entries.size()]);
+    entries.push_back(entry);
+  }
+  DeleteMem(header);
+
+  // Slots of kept entries still refer to the current index file, which
+  // Save() reads from before replacing it.
+  m_entries.swap(entries);
+  m_pending.swap(pending);
+  BuildIndex();
+  Save();
+  return read;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+void ContainerLibrary::Search(const String& query, std::vector<LONG>& out) const
+{
+  TRACE_SCOPE("ContainerLibrary::Search");
+  out.clear();
+  std::vector<std::string> words;
+  Tokenize(query, words);
+  if (words.empty())
+  {
+    for (LONG i = 0; i < GetCount(); ++i)
+      if (m_entries[i].valid)
+        out.push_back(i);
+    return;
+  }
+
+  Bool first = true;
+  std::vector<LONG> matches, merged;
+  for (const std::string& word : words)
+  {
+    // Union of all terms that start with the word.
+    matches.clear();
+    for (auto it = m_terms.lower_bound(word);
+         it != m_terms.end() && it->first.compare(0, word.size(), word) == 0; ++it)
+    {
+      merged.clear();
+      std::set_union(matches.begin(), matches.end(), it->second.begin(), it->second.end(),
+        std::back_inserter(merged));
+      matches.swap(merged);
+    }
+
+    if (first)
+      out.swap(matches);
+    else
+    {
+      merged.clear();
+      std::set_intersection(out.begin(), out.end(), matches.begin(), matches.end(),
+        std::back_inserter(merged));
+      out.swap(merged);
+    }
+    first = false;
+    if (out.empty()) break;
+  }
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+LONG ContainerLibrary::GetValidCount() const
+{
+  LONG count = 0;
+  for (const Entry& entry : m_entries)
+    if (entry.valid)
+      ++count;
+  return count;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+BaseBitmap* ContainerLibrary::GetThumbnail(LONG index) const
+{
+  if (index < 0 || index >= GetCount()) return nullptr;
+  Thumbnail thumb;
+  auto it = m_pending.find(index);
+  if (it != m_pending.end())
+    thumb = it->second;
+  else if (!ReadThumbnail(m_entries[index].thumbSlot, thumb))
+    return nullptr;
+
+  BaseBitmap* bmp = BaseBitmap::Alloc();
+  if (!bmp || bmp->Init(THUMBSIZE, THUMBSIZE, 32) != IMAGERESULT_OK)
+  {
+    BaseBitmap::Free(bmp);
+    return nullptr;
+  }
+  BaseBitmap* alpha = bmp->AddChannel(true, false);
+  for (LONG y = 0; y < THUMBSIZE; ++y)
+  {
+    for (LONG x = 0; x < THUMBSIZE; ++x)
+    {
+      const UChar* p = &thumb[(y * THUMBSIZE + x) * 4];
+      bmp->SetPixel(x, y, p[0], p[1], p[2]);
+      if (alpha)
+        bmp->SetAlphaPixel(alpha, x, y, p[3]);
+    }
+  }
+  return bmp;
+}
+
+/// ***************************************************************************
+/// Draws the thumbnail of the selected asset next to the result list.
+/// ***************************************************************************
+class ContainerThumbnailArea : public GeUserArea
+{
+  BaseBitmap* m_bmp;
+
+public:
+
+  /// Thumbnails are drawn at twice their stored size.
+  static const LONG SIZE = ContainerLibrary::THUMBSIZE * 2;
+
+  ContainerThumbnailArea() : m_bmp(nullptr) { }
+  virtual ~ContainerThumbnailArea() { BaseBitmap::Free(m_bmp); }
+
+  /// Takes ownership of *bmp*, which may be \c nullptr.
+  void SetBitmap(BaseBitmap* bmp)
+  {
+    BaseBitmap::Free(m_bmp);
+    m_bmp = bmp;
+    Redraw();
+  }
+
+  virtual Bool GetMinSize(LONG& w, LONG& h) override
+  {
+    w = h = SIZE;
+    return true;
+  }
+
+  virtual void DrawMsg(LONG x1, LONG y1, LONG x2, LONG y2, const BaseContainer& msg) override
+  {
+    OffScreenOn();
+    DrawSetPen(COLOR_BG);
+    DrawRectangle(x1, y1, x2, y2);
+    if (m_bmp)
+      DrawBitmap(m_bmp, 0, 0, SIZE, SIZE, 0, 0, m_bmp->GetBw(), m_bmp->GetBh(),
+        BMP_NORMALSCALED | BMP_ALLOWALPHA);
+  }
+};
+
+/// ***************************************************************************
+/// Lists the assets of a library directory that match a search and
+/// imports the selected one into the active document.
+/// ***************************************************************************
+class ContainerLibraryDialog : public GeDialog
+{
+  enum
+  {
+    TXT_DIRECTORY = 1000,
+    BTN_DIRECTORY,
+    BTN_RESCAN,
+    EDT_SEARCH,
+    LST_RESULTS,
+    UA_THUMBNAIL,
+    TXT_STATUS,
+    BTN_IMPORT,
+  };
+
+  enum
+  {
+    COL_NAME = 'name',
+    COL_VERSION = 'vers',
+    COL_AUTHOR = 'auth',
+    COL_PATH = 'path',
+  };
+
+  ContainerLibrary m_library;
+  SimpleListView m_list;
+  ContainerThumbnailArea m_thumbnail;
+  std::vector<LONG> m_results;
+
+public:
+
+  virtual Bool CreateLayout() override
+  {
+    SetTitle(GeLoadString(IDS_COMMAND_CONTAINERLIBRARY_TITLE));
+    GroupBegin(0, BFH_SCALEFIT, 3, 0, ""_s, 0);
+    {
+      AddStaticText(TXT_DIRECTORY, BFH_SCALEFIT, 0, 0, ""_s, 0);
+      AddButton(BTN_DIRECTORY, BFH_RIGHT, 0, 0, "..."_s);
+      AddButton(BTN_RESCAN, BFH_RIGHT, 0, 0, GeLoadString(IDS_LIBRARY_RESCAN));
+      GroupEnd();
+    }
+    AddEditText(EDT_SEARCH, BFH_SCALEFIT, 300, 0);
+    GroupBegin(0, BFH_SCALEFIT | BFV_SCALEFIT, 2, 0, ""_s, 0);
+    {
+      AddListView(LST_RESULTS, BFH_SCALEFIT | BFV_SCALEFIT, 500, 300);
+      AddUserArea(UA_THUMBNAIL, BFH_LEFT | BFV_TOP,
+        ContainerThumbnailArea::SIZE, ContainerThumbnailArea::SIZE);
+      AttachUserArea(m_thumbnail, UA_THUMBNAIL);
+      GroupEnd();
+    }
+    GroupBegin(0, BFH_SCALEFIT, 2, 0, ""_s, 0);
+    {
+      AddStaticText(TXT_STATUS, BFH_SCALEFIT, 0, 0, ""_s, 0);
+      AddButton(BTN_IMPORT, BFH_RIGHT, 0, 0, GeLoadString(IDS_LIBRARY_IMPORT));
+      GroupEnd();
+    }
+    return true;
+  }
+
+  virtual Bool InitValues() override
+  {
+    if (!m_list.AttachListView(this, LST_RESULTS)) return false;
+    BaseContainer layout;
+    layout.SetInt32(COL_NAME, LV_COLUMN_TEXT);
+    layout.SetInt32(COL_VERSION, LV_COLUMN_TEXT);
+    layout.SetInt32(COL_AUTHOR, LV_COLUMN_TEXT);
+    layout.SetInt32(COL_PATH, LV_COLUMN_TEXT);
+    m_list.SetLayout(4, layout);
+
+    BaseContainer* prefs = GetWorldPluginData(CONTAINERLIBRARY_PREFS);
+    if (prefs)
+      OpenLibrary(prefs->GetFilename(CONTAINERLIBRARY_PREFS_DIRECTORY), false);
+    return true;
+  }
+
+  virtual Bool Command(LONG id, const BaseContainer& msg) override
+  {
+    switch (id)
+    {
+      case BTN_DIRECTORY:
+      {
+        Filename dir;
+        if (dir.FileSelect(FILESELECTTYPE_ANYTHING, FILESELECT_DIRECTORY,
+            GeLoadString(IDS_COMMAND_CONTAINERLIBRARY_TITLE)))
+          OpenLibrary(dir, true);
+        break;
+      }
+      case BTN_RESCAN:
+        Rescan();
+        break;
+      case EDT_SEARCH:
+        UpdateResults();
+        break;
+      case LST_RESULTS:
+        if (msg.GetInt32(BFM_ACTION_VALUE) == LV_SIMPLE_SELECTIONCHANGED)
+          UpdateThumbnail();
+        break;
+      case BTN_IMPORT:
+        ImportSelected();
+        break;
+    }
+    return true;
+  }
+
+private:
+
+  void OpenLibrary(const Filename& dir, Bool remember)
+  {
+    if (!dir.Content()) return;
+    SetString(TXT_DIRECTORY, dir.GetString());
+    if (remember)
+    {
+      BaseContainer prefs;
+      prefs.SetFilename(CONTAINERLIBRARY_PREFS_DIRECTORY, dir);
+      SetWorldPluginData(CONTAINERLIBRARY_PREFS, prefs, true);
+    }
+    if (!m_library.Open(dir))
+      Rescan();
+    else
+      UpdateResults();
+  }
+
+  void Rescan()
+  {
+    const Float start = GeGetMilliSeconds();
+    const LONG read = m_library.Rescan();
+    UpdateResults();
+    SetString(TXT_STATUS, GeLoadString(IDS_LIBRARY_RESCANNED,
+      String::IntToString(m_library.GetValidCount()), String::IntToString(read),
+      RealToString(GeGetMilliSeconds() - start, -1, 1)));
+  }
+
+  void UpdateResults()
+  {
+    String query;
+    GetString(EDT_SEARCH, query);
+    const Float start = GeGetMilliSeconds();
+    m_library.Search(query, m_results);
+    const Float elapsed = GeGetMilliSeconds() - start;
+
+    m_list.RemoveAll();
+    BaseContainer item;
+    for (size_t i = 0; i < m_results.size(); ++i)
+    {
+      const ContainerLibrary::Entry& entry = m_library.Get(m_results[i]);
+      item.SetString(COL_NAME, entry.name);
+      item.SetString(COL_VERSION, entry.version);
+      item.SetString(COL_AUTHOR, entry.author);
+      item.SetString(COL_PATH, entry.path.GetString());
+      m_list.SetItem((LONG) i, item);
+    }
+    m_list.DataChanged();
+    UpdateThumbnail();
+    SetString(TXT_STATUS, GeLoadString(IDS_LIBRARY_RESULTS,
+      String::IntToString((Int64) m_results.size()), RealToString(elapsed, -1, 2)));
+  }
+
+  /// Returns the index of the selected result or -1.
+  LONG GetSelectedResult()
+  {
+    AutoAlloc<BaseSelect> sel;
+    if (!sel || !m_list.GetSelection(sel)) return -1;
+    const LONG index = sel->GetNextSelected(0);
+    if (index < 0 || index >= (LONG) m_results.size()) return -1;
+    return index;
+  }
+
+  void UpdateThumbnail()
+  {
+    const LONG index = GetSelectedResult();
+    m_thumbnail.SetBitmap(index < 0 ? nullptr : m_library.GetThumbnail(m_results[index]));
+  }
+
+  void ImportSelected()
+  {
+    BaseDocument* doc = GetActiveDocument();
+    const LONG index = GetSelectedResult();
+    if (!doc || index < 0) return;
+
+    doc->StartUndo();
+    BaseObject* op = ContainerAssetImport(m_library.Get(m_results[index]).path, doc);
+    doc->EndUndo();
+    if (!op)
+    {
+      MessageDialog(GeLoadString(IDS_INFO_INVALIDSCENEFILE));
+      return;
+    }
+    doc->SetActiveObject(op);
+    EventAdd();
+  }
+};
+
+/// ***************************************************************************
+/// ***************************************************************************
+class ContainerLibraryCommand : public CommandData
+{
+  ContainerLibraryDialog m_dialog;
+
+public:
+
+  C4D_APIBRIDGE_COMMANDDATA_EXECUTE(doc)
+  {
+    return m_dialog.Open(DLG_TYPE_ASYNC, ID_COMMAND_CONTAINERLIBRARY, -1, -1, 600, 400);
+  }
+
+  virtual Bool RestoreLayout(void* secret) override
+  {
+    return m_dialog.RestoreLayout(ID_COMMAND_CONTAINERLIBRARY, 0, secret);
+  }
+};
+
+/// ***************************************************************************
+/// ***************************************************************************
+Bool RegisterContainerLibrary()
+{
+  return RegisterCommandPlugin(
+    ID_COMMAND_CONTAINERLIBRARY,
+    GeLoadString(IDS_COMMAND_CONTAINERLIBRARY_TITLE),
+    0,
+    nullptr,
+    GeLoadString(IDS_COMMAND_CONTAINERLIBRARY_HELP),
+    gNew(ContainerLibraryCommand));
+}
@@ -0,0 +1,86 @@
+/// Copyright (C) 2013-2015, Niklas Rosenstein
+/// All rights reserved.
+///
+/// Licensed under the GNU Lesser General Public License.
+///
+/// \file ContainerLibrary.h
+///
+/// Index over the container assets (see ContainerAsset.h) in a library
+/// directory. Only the asset headers are read. The index is kept in the
+/// library directory and assets are only read again when their
+/// modification time or size changed.
+
+#pragma once
+
+#include <c4d.h>
+#include <c4d_legacy.h>
+#include <map>
+#include <string>
+#include <vector>
+
+/// ***************************************************************************
+/// ***************************************************************************
+class ContainerLibrary
+{
+public:
+
+  /// Side length of the thumbnails stored in the index.
+  static const LONG THUMBSIZE = 32;
+
+  struct Entry
+  {
+    Filename path;
+    UInt64 mtime;
+    Int64 size;
+    String name;
+    String version;
+    String author;
+    String description;
+    LONG thumbSlot;  ///< Index in the thumbnail table of the index, -1 if none.
+    Bool valid;      ///< False if the header of the asset could not be read.
+  };
+
+  ContainerLibrary() : m_thumbsStart(0) { }
+
+  /// Binds the library to *dir* and loads its index if there is one.
+  Bool Open(const Filename& dir);
+
+  /// Updates the index from the assets in the library directory and
+  /// writes it. Returns the number of assets that had to be read.
+  LONG Rescan();
+
+  /// Returns the indices of all entries that contain every term of
+  /// *query* as a prefix of a word in their name, version, author or
+  /// description. Matching is case insensitive. Entries of assets that
+  /// could not be read are never returned.
+  void Search(const String& query, std::vector<LONG>& out) const;
+
+  LONG GetCount() const { return (LONG) m_entries.size(); }
+  /// Returns the number of entries whose asset header could be read.
+  LONG GetValidCount() const;
+  const Entry& Get(LONG index) const { return m_entries[index]; }
+
+  /// Returns the thumbnail of entry *index* or \c nullptr. The caller
+  /// owns the bitmap.
+  BaseBitmap* GetThumbnail(LONG index) const;
+
+private:
+
+  typedef std::vector<UChar> Thumbnail;
+
+  Bool Load();
+  Bool Save();
+  void BuildIndex();
+  Bool ReadThumbnail(LONG slot, Thumbnail& out) const;
+
+  Filename m_dir;
+  Filename m_indexFile;
+  Int64 m_thumbsStart;
+  std::vector<Entry> m_entries;
+  /// Thumbnails read during the last rescan that are not in the index
+  /// file yet, by entry index.
+  std::map<LONG, Thumbnail> m_pending;
+  /// Maps a lower case term to the sorted indices of the entries it
+  /// appears in.
+  std::map<std::string, std::vector<LONG>> m_terms;
+};
@@ -0,0 +1,598 @@
+/// Copyright (C) 2013-2015, Niklas Rosenstein
+/// All rights reserved.
+///
+/// Licensed under the GNU Lesser General Public License.
+///
+/// \file ContainerMemory.cpp
+///
+/// The "Container Memory" command estimates the memory held by every
+/// Container of the active document: point and polygon data (including
+/// the caches of generators and deformers), tags, animation tracks, user
+/// data, the materials used by the contents and the Container's own
+/// icon and caches. The document is walked once and the bytes of each
+/// object are added to all Containers it is nested in. The sizes of
+/// objects and materials are cached with their dirty counts, so running
+/// the report again only measures what changed. Container parameters and
+/// internal allocations of Cinema 4D can't be seen from the API, the
+/// numbers are a lower bound for comparing rigs.
+
+#include <c4d.h>
+#include <c4d_apibridge.h>
+#include <Ocontainer.h>
+#include "res/c4d_symbols.h"
+#include "ContainerObject.h"
+#include "Utils/Misc.h"
+#include "Utils/Trace.h"
+
+#include <algorithm>
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+enum
+{
+  ID_COMMAND_MEMORYREPORT = 1039520,
+};
+
+/// Approximate size of an animation key with its tangents.
+static const Int64 MEMORY_KEYBYTES = 96;
+
+/// ***************************************************************************
+/// The columns of the report, in the order of the list view.
+/// ***************************************************************************
+enum MEMORYCOLUMN
+{
+  MEMORY_GEOMETRY,
+  MEMORY_TAGS,
+  MEMORY_TRACKS,
+  MEMORY_USERDATA,
+  MEMORY_MATERIALS,
+  MEMORY_CONTAINER,
+  MEMORY_COLUMNS,
+};
+
+/// ***************************************************************************
+/// One line of the report.
+/// ***************************************************************************
+struct MemoryRow
+{
+  BaseObject* op;    ///< Only valid during MemoryAccounting::Measure().
+  std::string name;  ///< UTF-8, for sorting and the CSV file.
+  LONG objects;
+  Bool nested;       ///< Part of another Container of the report.
+  Int64 bytes[MEMORY_COLUMNS];
+
+  Int64 Total() const
+  {
+    Int64 total = 0;
+    for (LONG i = 0; i < MEMORY_COLUMNS; ++i)
+      total += bytes[i];
+    return total;
+  }
+};
+
+/// ***************************************************************************
+/// Returns *str* as UTF-8.
+/// ***************************************************************************
+static std::string ToUtf8(const String& str)
+{
+  std::string result;
+  Char* utf8 = str.GetCStringCopy(STRINGENCODING_UTF8);
+  if (utf8)
+  {
+    result = utf8;
+    DeleteMem(utf8);
+  }
+  return result;
+}
+
+/// ***************************************************************************
+/// Estimates the bytes of the values in *bc*, including sub-containers.
+/// ***************************************************************************
+static Int64 GetContainerBytes(const BaseContainer* bc)
+{
+  if (!bc) return 0;
+  Int64 bytes = sizeof(BaseContainer);
+  for (LONG i = 0; bc->GetIndexId(i) != NOTOK; ++i)
+  {
+    bytes += sizeof(Int32) + sizeof(GeData);
+    const GeData* data = bc->GetIndexData(i);
+    if (!data) continue;
+    switch (data->GetType())
+    {
+      case DA_STRING:
+        bytes += data->GetString().GetLength() * sizeof(UInt16);
+        break;
+      case DA_CONTAINER:
+        bytes += GetContainerBytes(data->GetContainer());
+        break;
+      default:
+        break;
+    }
+  }
+  return bytes;
+}
+
+/// ***************************************************************************
+/// Returns the bytes of the points and polygons of *op* itself.
+/// ***************************************************************************
+static Int64 GetGeometryBytes(BaseObject* op)
+{
+  Int64 bytes = 0;
+  if (op->IsInstanceOf(Opoint))
+    bytes += (Int64) ToPoint(op)->GetPointCount() * sizeof(Vector);
+  if (op->IsInstanceOf(Opolygon))
+    bytes += (Int64) ToPoly(op)->GetPolygonCount() * sizeof(CPolygon);
+  return bytes;
+}
+
+/// ***************************************************************************
+/// Returns the bytes of the points and polygons in the cache *cache*.
+/// ***************************************************************************
+static Int64 GetCacheBytes(BaseObject* cache)
+{
+  if (!cache) return 0;
+  Int64 bytes = GetGeometryBytes(cache);
+  bytes += GetCacheBytes(cache->GetDeformCache());
+  bytes += GetCacheBytes(cache->GetCache());
+  for (BaseObject* child = cache->GetDown(); child; child = child->GetNext())
+    bytes += GetCacheBytes(child);
+  return bytes;
+}
+
+/// ***************************************************************************
+/// Returns the estimated bytes of the tracks of *node*.
+/// ***************************************************************************
+static Int64 GetTrackBytes(BaseList2D* node)
+{
+  Int64 bytes = 0;
+  for (CTrack* track = node->GetFirstCTrack(); track; track = track->GetNext())
+  {
+    CCurve* curve = track->GetCurve();
+    bytes += GetContainerBytes(track->GetDataInstance());
+    if (curve)
+      bytes += curve->GetKeyCount() * MEMORY_KEYBYTES;
+  }
+  return bytes;
+}
+
+/// ***************************************************************************
+/// Adds the dirty counts of the tracks of *node* to *stamp*.
+/// ***************************************************************************
+static UInt32 AddTrackStamp(BaseList2D* node, UInt32 stamp)
+{
+  for (CTrack* track = node->GetFirstCTrack(); track; track = track->GetNext())
+    stamp = stamp * 31 + track->GetDirty(DIRTYFLAGS_DATA);
+  return stamp;
+}
+
+/// ***************************************************************************
+/// Returns the estimated bytes of the user data of *node*.
+/// ***************************************************************************
+static Int64 GetUserDataBytes(BaseList2D* node)
+{
+  BaseContainer* bc = node->GetDataInstance();
+  return bc ? GetContainerBytes(bc->GetContainerInstance(ID_USERDATA)) : 0;
+}
+
+/// ***************************************************************************
+/// Measures the objects of a document and caches the result per node.
+/// ***************************************************************************
+class MemoryAccounting
+{
+public:
+
+  MemoryAccounting() : m_generation(0), m_measured(0), m_visited(0) { }
+
+  /// Fills *rows* with one entry per Container of *doc*.
+  void Measure(BaseDocument* doc, std::vector<MemoryRow>& rows)
+  {
+    TRACE_SCOPE("MemoryAccounting::Measure");
+    ++m_generation;
+    m_measured = m_visited = 0;
+    rows.clear();
+
+    // Forget nodes that were freed or are not part of *doc* before
+    // anything is looked up, a new node may reuse their address.
+    for (auto it = m_cache.begin(); it != m_cache.end(); )
+    {
+      if (it->second.link->GetLink(doc) != it->first) it = m_cache.erase(it);
+      else ++it;
+    }
+
+    std::vector<std::set<BaseMaterial*>> materials;
+    std::vector<size_t> open;
+    Walk(doc->GetFirstObject(), rows, materials, open);
+
+    for (size_t i = 0; i < rows.size(); ++i)
+    {
+      for (BaseMaterial* mat : materials[i])
+        rows[i].bytes[MEMORY_MATERIALS] += GetMaterialBytes(mat);
+      rows[i].bytes[MEMORY_CONTAINER] = ContainerGetDataSize(rows[i].op);
+    }
+
+    // Forget nodes that were not visited.
+    for (auto it = m_cache.begin(); it != m_cache.end(); )
+    {
+      if (it->second.generation != m_generation) it = m_cache.erase(it);
+      else ++it;
+    }
+  }
+
+  /// The number of objects measured and visited by the last Measure().
+  LONG GetMeasured() const { return m_measured; }
+  LONG GetVisited() const { return m_visited; }
+
+private:
+
+  struct NodeBytes
+  {
+    Int64 geometry;
+    Int64 tags;
+    Int64 tracks;
+    Int64 userData;
+  };
+
+  struct LinkDeleter
+  {
+    void operator () (BaseLink* link) const { BaseLink::Free(link); }
+  };
+
+  struct Entry
+  {
+    std::unique_ptr<BaseLink, LinkDeleter> link;  ///< Tells if the node is still alive.
+    LONG type;
+    UInt32 stamp;
+    UInt32 generation;
+    NodeBytes bytes;
+  };
+
+  /// Walks the objects from *op* on, *open* holds the rows of the
+  /// Containers that the objects are nested in.
+  void Walk(BaseObject* op, std::vector<MemoryRow>& rows,
+    std::vector<std::set<BaseMaterial*>>& materials, std::vector<size_t>& open)
+  {
+    for (; op; op = op->GetNext())
+    {
+      ++m_visited;
+      const NodeBytes bytes = GetObjectBytes(op);
+      const Bool container = op->GetType() == Ocontainer;
+      if (container)
+      {
+        MemoryRow row;
+        row.op = op;
+        row.name = ToUtf8(op->GetName());
+        row.objects = 0;
+        row.nested = !open.empty();
+        std::fill(row.bytes, row.bytes + MEMORY_COLUMNS, 0);
+        open.push_back(rows.size());
+        rows.push_back(row);
+        materials.emplace_back();
+      }
+
+      for (size_t index : open)
+      {
+        MemoryRow& row = rows[index];
+        if (row.op != op) ++row.objects;
+        row.bytes[MEMORY_GEOMETRY] += bytes.geometry;
+        row.bytes[MEMORY_TAGS] += bytes.tags;
+        row.bytes[MEMORY_TRACKS] += bytes.tracks;
+        row.bytes[MEMORY_USERDATA] += bytes.userData;
+        for (BaseTag* tag = op->GetFirstTag(); tag; tag = tag->GetNext())
+        {
+          BaseMaterial* mat = tag->GetType() == Ttexture ? static_cast<TextureTag*>(tag)->GetMaterial() : nullptr;
+          if (mat) materials[index].insert(mat);
+        }
+      }
+
+      Walk(op->GetDown(), rows, materials, open);
+      if (container)
+        open.pop_back();
+    }
+  }
+
+  /// Returns the bytes of *op*, from the cache if it did not change.
+  NodeBytes GetObjectBytes(BaseObject* op)
+  {
+    UInt32 stamp = op->GetDirty(DIRTYFLAGS_DATA | DIRTYFLAGS_CACHE);
+    stamp = AddTrackStamp(op, stamp);
+    for (BaseTag* tag = op->GetFirstTag(); tag; tag = tag->GetNext())
+      stamp = AddTrackStamp(tag, stamp * 31 + tag->GetDirty(DIRTYFLAGS_DATA));
+
+    Entry* entry = GetEntry(op);
+    if (!entry) return NodeBytes{0, 0, 0, 0};
+    const Bool valid = entry->generation != 0 && entry->type == op->GetType() && entry->stamp == stamp;
+    entry->generation = m_generation;
+    if (valid) return entry->bytes;
+    ++m_measured;
+
+    NodeBytes& bytes = entry->bytes;
+    entry->type = op->GetType();
+    entry->stamp = stamp;
+    bytes.geometry = GetGeometryBytes(op) + GetCacheBytes(op->GetDeformCache())
+      + GetCacheBytes(op->GetCache());
+    bytes.tracks = GetTrackBytes(op);
+    bytes.userData = GetUserDataBytes(op);
+    bytes.tags = 0;
+    for (BaseTag* tag = op->GetFirstTag(); tag; tag = tag->GetNext())
+    {
+      bytes.tags += GetContainerBytes(tag->GetDataInstance());
+      if (tag->GetInfo() & TAG_VARIABLE)
+      {
+        VariableTag* vtag = static_cast<VariableTag*>(tag);
+        bytes.tags += (Int64) vtag->GetDataCount() * vtag->GetDataSize();
+      }
+      bytes.tracks += GetTrackBytes(tag);
+      bytes.userData += GetUserDataBytes(tag);
+    }
+    return bytes;
+  }
+
+  /// Returns the bytes of the parameters of *mat* and its shaders.
+  Int64 GetMaterialBytes(BaseMaterial* mat)
+  {
+    UInt32 stamp = mat->GetDirty(DIRTYFLAGS_DATA);
+    for (BaseShader* shader = mat->GetFirstShader(); shader; shader = GetNextNode(shader, (BaseShader*) nullptr))
+      stamp = stamp * 31 + shader->GetDirty(DIRTYFLAGS_DATA);
+    Entry* entry = GetEntry(mat);
+    if (!entry) return 0;
+    const Bool valid = entry->generation != 0 && entry->type == mat->GetType() && entry->stamp == stamp;
+    entry->generation = m_generation;
+    if (valid) return entry->bytes.geometry;
+
+    Int64 bytes = GetContainerBytes(mat->GetDataInstance());
+    for (BaseShader* shader = mat->GetFirstShader(); shader; shader = GetNextNode(shader, (BaseShader*) nullptr))
+      bytes += GetContainerBytes(shader->GetDataInstance());
+    entry->type = mat->GetType();
+    entry->stamp = stamp;
+    entry->bytes = NodeBytes{bytes, 0, 0, 0};
+    return bytes;
+  }
+
+  /// Returns the cache entry of *node*, a new entry has a generation of 0.
+  Entry* GetEntry(BaseList2D* node)
+  {
+    Entry& entry = m_cache[node];
+    if (!entry.link)
+    {
+      entry.link.reset(BaseLink::Alloc());
+      if (!entry.link)
+      {
+        m_cache.erase(node);
+        return nullptr;
+      }
+      entry.link->SetLink(node);
+    }
+    return &entry;
+  }
+
+  std::unordered_map<BaseList2D*, Entry> m_cache;
+  UInt32 m_generation;
+  LONG m_measured;
+  LONG m_visited;
+};
+
+/// ***************************************************************************
+/// Formats *bytes* as KB or MB.
+/// ***************************************************************************
+static String FormatBytes(Int64 bytes)
+{
+  if (bytes >= 1024 * 1024)
+    return RealToString(bytes / (1024.0 * 1024.0), -1, 1) + " MB";
+  return RealToString(bytes / 1024.0, -1, 1) + " KB";
+}
+
+/// ***************************************************************************
+/// Lists the Containers of the active document by their memory use.
+/// ***************************************************************************
+class MemoryReportDialog : public GeDialog
+{
+  enum
+  {
+    CMB_SORT = 1000,
+    BTN_REFRESH,
+    BTN_EXPORT,
+    LST_REPORT,
+    TXT_STATUS,
+  };
+
+  /// Sort orders, the columns and the name.
+  enum
+  {
+    SORT_TOTAL = 0,
+    SORT_COLUMN,  // + MEMORYCOLUMN
+    SORT_NAME = SORT_COLUMN + MEMORY_COLUMNS,
+  };
+
+  enum
+  {
+    COL_NAME = 'name',
+    COL_OBJECTS = 'objs',
+    COL_TOTAL = 'totl',
+    COL_FIRST = 'c000',  // + MEMORYCOLUMN
+  };
+
+  MemoryAccounting m_accounting;
+  SimpleListView m_list;
+  std::vector<MemoryRow> m_rows;
+
+public:
+
+  virtual Bool CreateLayout() override
+  {
+    SetTitle(GeLoadString(IDS_COMMAND_MEMORYREPORT_TITLE));
+    GroupBegin(0, BFH_SCALEFIT, 3, 0, ""_s, 0);
+    {
+      AddComboBox(CMB_SORT, BFH_SCALEFIT);
+      AddChild(CMB_SORT, SORT_TOTAL, GeLoadString(IDS_MEMORY_TOTAL));
+      for (LONG i = 0; i < MEMORY_COLUMNS; ++i)
+        AddChild(CMB_SORT, SORT_COLUMN + i, GeLoadString(IDS_MEMORY_GEOMETRY + i));
+      AddChild(CMB_SORT, SORT_NAME, GeLoadString(IDS_MEMORY_NAME));
+      AddButton(BTN_REFRESH, BFH_RIGHT, 0, 0, GeLoadString(IDS_MEMORY_REFRESH));
+      AddButton(BTN_EXPORT, BFH_RIGHT, 0, 0, GeLoadString(IDS_MEMORY_EXPORT));
+      GroupEnd();
+    }
+    AddListView(LST_REPORT, BFH_SCALEFIT | BFV_SCALEFIT, 700, 300);
+    AddStaticText(TXT_STATUS, BFH_SCALEFIT, 0, 0, ""_s, 0);
+    return true;
+  }
+
+  virtual Bool InitValues() override
+  {
+    if (!m_list.AttachListView(this, LST_REPORT)) return false;
+    BaseContainer layout;
+    layout.SetInt32(COL_NAME, LV_COLUMN_TEXT);
+    layout.SetInt32(COL_OBJECTS, LV_COLUMN_TEXT);
+    layout.SetInt32(COL_TOTAL, LV_COLUMN_TEXT);
+    for (LONG i = 0; i < MEMORY_COLUMNS; ++i)
+      layout.SetInt32(COL_FIRST + i, LV_COLUMN_TEXT);
+    m_list.SetLayout(3 + MEMORY_COLUMNS, layout);
+    SetInt32(CMB_SORT, SORT_TOTAL);
+    Refresh();
+    return true;
+  }
+
+  virtual Bool Command(LONG id, const BaseContainer& msg) override
+  {
+    switch (id)
+    {
+      case CMB_SORT:
+        Sort();
+        break;
+      case BTN_REFRESH:
+        Refresh();
+        break;
+      case BTN_EXPORT:
+        Export();
+        break;
+    }
+    return true;
+  }
+
+private:
+
+  void Refresh()
+  {
+    BaseDocument* doc = GetActiveDocument();
+    if (!doc) return;
+    const Float start = GeGetMilliSeconds();
+    m_accounting.Measure(doc, m_rows);
+    const Float elapsed = GeGetMilliSeconds() - start;
+
+    // Nested Containers are part of their parents, only count the
+    // outermost ones for the document total.
+    Int64 total = 0;
+    for (const MemoryRow& row : m_rows)
+    {
+      if (!row.nested) total += row.Total();
+    }
+    Sort();
+    SetString(TXT_STATUS, GeLoadString(IDS_MEMORY_STATUS,
+      String::IntToString((Int64) m_rows.size()), FormatBytes(total),
+      String::IntToString(m_accounting.GetMeasured()), String::IntToString(m_accounting.GetVisited()),
+      RealToString(elapsed, -1, 1)));
+  }
+
+  void Sort()
+  {
+    Int32 order = SORT_TOTAL;
+    GetInt32(CMB_SORT, order);
+    std::stable_sort(m_rows.begin(), m_rows.end(), [order](const MemoryRow& a, const MemoryRow& b) {
+      if (order == SORT_NAME) return a.name < b.name;
+      if (order >= SORT_COLUMN && order < SORT_NAME)
+        return a.bytes[order - SORT_COLUMN] > b.bytes[order - SORT_COLUMN];
+      return a.Total() > b.Total();
+    });
+    Fill();
+  }
+
+  /// The first line holds the column titles, the list view has none.
+  void Fill()
+  {
+    m_list.RemoveAll();
+    BaseContainer item;
+    item.SetString(COL_NAME, GeLoadString(IDS_MEMORY_NAME));
+    item.SetString(COL_OBJECTS, GeLoadString(IDS_MEMORY_OBJECTS));
+    item.SetString(COL_TOTAL, GeLoadString(IDS_MEMORY_TOTAL));
+    for (LONG i = 0; i < MEMORY_COLUMNS; ++i)
+      item.SetString(COL_FIRST + i, GeLoadString(IDS_MEMORY_GEOMETRY + i));
+    m_list.SetItem(0, item);
+    for (size_t i = 0; i < m_rows.size(); ++i)
+    {
+      const MemoryRow& row = m_rows[i];
+      item.SetString(COL_NAME, String(row.name.c_str(), STRINGENCODING_UTF8));
+      item.SetString(COL_OBJECTS, String::IntToString(row.objects));
+      item.SetString(COL_TOTAL, FormatBytes(row.Total()));
+      for (LONG j = 0; j < MEMORY_COLUMNS; ++j)
+        item.SetString(COL_FIRST + j, FormatBytes(row.bytes[j]));
+      m_list.SetItem((LONG) i + 1, item);
+    }
+    m_list.DataChanged();
+  }
+
+  /// Writes the rows in the current order with sizes in bytes.
+  void Export()
+  {
+    Filename fn;
+    fn.SetFile("container_memory.csv"_s);
+    if (!fn.FileSelect(FILESELECTTYPE_ANYTHING, FILESELECT_SAVE, GeLoadString(IDS_MEMORY_EXPORT)))
+      return;
+
+    std::string csv = "name,objects,total";
+    for (LONG i = 0; i < MEMORY_COLUMNS; ++i)
+      csv += "," + ToUtf8(GeLoadString(IDS_MEMORY_GEOMETRY + i));
+    csv += "\n";
+    for (const MemoryRow& row : m_rows)
+    {
+      std::string name;
+      for (char c : row.name)
+      {
+        if (c == '"') name += '"';
+        name += c;
+      }
+      csv += "\"" + name + "\"," + std::to_string(row.objects) + "," + std::to_string(row.Total());
+      for (LONG i = 0; i < MEMORY_COLUMNS; ++i)
+        csv += "," + std::to_string(row.bytes[i]);
+      csv += "\n";
+    }
+
+    AutoAlloc<BaseFile> file;
+    if (!file || !file->Open(fn, FILEOPEN_WRITE, FILEDIALOG_NONE) ||
+        !file->WriteBytes(csv.data(), csv.size()))
+      MessageDialog(GeLoadString(IDS_INFO_MEMORYEXPORTFAILED));
+  }
+};
+
+/// ***************************************************************************
+/// ***************************************************************************
+class MemoryReportCommand : public CommandData
+{
+  MemoryReportDialog m_dialog;
+
+public:
+
+  C4D_APIBRIDGE_COMMANDDATA_EXECUTE(doc)
+  {
+    return m_dialog.Open(DLG_TYPE_ASYNC, ID_COMMAND_MEMORYREPORT, -1, -1, 800, 400);
+  }
+
+  virtual Bool RestoreLayout(void* secret) override
+  {
+    return m_dialog.RestoreLayout(ID_COMMAND_MEMORYREPORT, 0, secret);
+  }
+};
+
+/// ***************************************************************************
+/// ***************************************************************************
+Bool RegisterContainerMemoryReport()
+{
+  return RegisterCommandPlugin(
+    ID_COMMAND_MEMORYREPORT,
+    GeLoadString(IDS_COMMAND_MEMORYREPORT_TITLE),
+    0,
+    nullptr,
+    GeLoadString(IDS_COMMAND_MEMORYREPORT_HELP),
+    gNew(MemoryReportCommand));
+}
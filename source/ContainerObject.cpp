@@ -12,103 +12,506 @@
 #include <c4d_apibridge.h>
 #include <lib_clipmap.h>
 #include <lib_iconcollection.h>
+#include <oinstance.h>
 
 /// Resource Symbols
 #include <Ocontainer.h>
+#include <Tcontainerlod.h>
 #include "res/c4d_symbols.h"
 
 #include "Utils/Misc.h"
 #include "Utils/AABB.h"
+#include "Utils/Counters.h"
+#include "Utils/Trace.h"
+#include "Utils/Suspend.h"
+#include "Utils/FrozenMesh.h"
+#include "Utils/PackedHierarchy.h"
+#include "Utils/MotionBounds.h"
+#include "Utils/JobSystem.h"
+#include "Generated/EmbeddedIcons.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 
 using c4d_apibridge::GetDescriptionID;
 using c4d_apibridge::IsEmpty;
 
 /// ***************************************************************************
+/// Protecting and unprotecting a container runs in two phases. The plan
+/// phase only reads the scene and collects the nodes whose visibility
+/// changes; it runs in parallel over the subtrees of the container. The
+/// apply phase then flips the bits of the collected nodes in a serial
+/// loop on the calling thread.
+///
+/// The plan jobs only walk the hierarchy and the tag lists while the
+/// calling thread (the main thread) waits for them, so the document
+/// can't change underneath. Everything else they need is read up front
+/// on the calling thread: the protection state comes from a snapshot of
+/// the registry and material links are resolved after the jobs are done.
 /// ***************************************************************************
-template <typename T>
-static inline T* GetNodeData(GeListNode* node) {
-  #if API_VERSION >= 17000
-    return node->GetNodeData<T>();
-  #else
-    return static_cast<T*>(node->GetNodeData());
-  #endif
+struct HidePlanContext
+{
+  BaseDocument* doc;  ///< Used to resolve material links, may be nullptr.
+  Bool materials;     ///< Collect the materials of texture tags.
+  const std::unordered_set<BaseObject*>* protectedSet;
+};
+
+/// ***************************************************************************
+/// Returns true if the children of *op* are managed by a protected
+/// Container or a "protected" Null-Object and must not be modified.
+/// ***************************************************************************
+static Bool IsProtectedNode(const HidePlanContext& ctx, BaseObject* op)
+{
+  if (ctx.protectedSet)
+    return ctx.protectedSet->count(op) != 0;
+  ContainerInfo info;
+  return ContainerLookup(op, &info) && info.isProtected;
+}
+
+/// ***************************************************************************
+/// The nodes collected by a plan job. Texture tags are kept so their
+/// materials can be resolved on the calling thread.
+/// ***************************************************************************
+struct HidePlanPart
+{
+  std::vector<BaseList2D*> nodes;
+  std::vector<BaseTag*> textureTags;
+};
+
+/// ***************************************************************************
+/// Appends the texture tags on *op* to *part*.
+/// ***************************************************************************
+static void PlanTextureTags(BaseObject* op, HidePlanPart& part)
+{
+  for (BaseTag* tag = op->GetFirstTag(); tag; tag = tag->GetNext())
+  {
+    if (tag->GetType() == Ttexture)
+      part.textureTags.push_back(tag);
+  }
+}
+
+/// ***************************************************************************
+/// Appends the materials of the collected texture tags of *part* to its
+/// nodes. Must be called on the calling thread of PlanHideNodes().
+/// ***************************************************************************
+static void ResolveMaterials(const HidePlanContext& ctx, HidePlanPart& part)
+{
+  for (BaseTag* tag : part.textureTags)
+  {
+    BaseContainer* bc = tag->GetDataInstance();
+    BaseList2D* mat = bc ? bc->GetLink(TEXTURETAG_MATERIAL, ctx.doc, Mbase) : nullptr;
+    if (mat) part.nodes.push_back(mat);
+  }
+  part.textureTags.clear();
+}
+
+/// ***************************************************************************
+/// Appends *op* and, unless *op* is protected itself, all objects below
+/// it to *part*. Texture tags are collected for the whole subtree,
+/// including protected ones.
+/// ***************************************************************************
+static void PlanSubtree(const HidePlanContext& ctx, BaseObject* op, HidePlanPart& part)
+{
+  part.nodes.push_back(op);
+  if (ctx.materials)
+    PlanTextureTags(op, part);
+  const Bool hideChildren = !IsProtectedNode(ctx, op);
+  for (BaseObject* child = op->GetDown(); child; child = child->GetNext())
+  {
+    if (hideChildren)
+      PlanSubtree(ctx, child, part);
+    else if (ctx.materials)
+    {
+      // Only the materials of the protected branch are needed.
+      for (NodeIterator<BaseObject> it(child, child); it; ++it)
+        PlanTextureTags(*it, part);
+    }
+  }
+}
+
+/// ***************************************************************************
+/// A unit of planning work: a whole subtree or only a single node whose
+/// children have been split off into their own items.
+/// ***************************************************************************
+struct HidePlanItem
+{
+  BaseObject* op;
+  Bool subtree;
+};
+
+/// ***************************************************************************
+/// Collects the nodes below *root* whose visibility changes in *out*.
+/// Tags of *root* are included if *tags* is true. Duplicates (materials
+/// used more than once) are removed. Must be called on the main thread.
+/// ***************************************************************************
+static void PlanHideNodes(BaseObject* root, Bool tags, const HidePlanContext& ctx,
+    std::vector<BaseList2D*>& out)
+{
+  TRACE_SCOPE("PlanHideNodes");
+  if (tags)
+  {
+    for (BaseTag* tag = root->GetFirstTag(); tag; tag = tag->GetNext())
+      out.push_back(tag);
+  }
+  if (ctx.materials)
+  {
+    HidePlanPart part;
+    PlanTextureTags(root, part);
+    ResolveMaterials(ctx, part);
+    out.insert(out.end(), part.nodes.begin(), part.nodes.end());
+  }
+
+  // Split the hierarchy into enough items to keep all workers busy,
+  // the subtrees of a rig are rarely balanced.
+  const LONG workers = JobSystemGetConcurrency();
+  std::vector<HidePlanItem> items;
+  for (BaseObject* child = root->GetDown(); child; child = child->GetNext())
+    items.push_back({child, true});
+  for (LONG depth = 0; depth < 4 && (LONG) items.size() < workers * 4; ++depth)
+  {
+    std::vector<HidePlanItem> split;
+    for (const HidePlanItem& item : items)
+    {
+      if (!item.subtree || !item.op->GetDown() || IsProtectedNode(ctx, item.op))
+      {
+        split.push_back(item);
+        continue;
+      }
+      split.push_back({item.op, false});
+      for (BaseObject* child = item.op->GetDown(); child; child = child->GetNext())
+        split.push_back({child, true});
+    }
+    if (split.size() == items.size()) break;
+    items.swap(split);
+  }
+
+  std::vector<HidePlanPart> parts(items.size());
+  auto plan = [&](size_t i) {
+    const HidePlanItem& item = items[i];
+    if (item.subtree)
+      PlanSubtree(ctx, item.op, parts[i]);
+    else
+    {
+      parts[i].nodes.push_back(item.op);
+      if (ctx.materials)
+        PlanTextureTags(item.op, parts[i]);
+    }
+  };
+
+  // Without a snapshot the protection state is read from the objects,
+  // which is left to the calling thread.
+  if (ctx.protectedSet)
+    ParallelFor(0, (LONG) items.size(), 1, [&](LONG i) { plan((size_t) i); });
+  else
+  {
+    for (size_t i = 0; i < items.size(); ++i)
+      plan(i);
+  }
+
+  std::unordered_set<BaseList2D*> seen(out.begin(), out.end());
+  for (HidePlanPart& part : parts)
+  {
+    ResolveMaterials(ctx, part);
+    for (BaseList2D* node : part.nodes)
+    {
+      if (seen.insert(node).second)
+        out.push_back(node);
+    }
+  }
+}
+
+/// ***************************************************************************
+/// Hides or reveals all *nodes* in the Object Manager and Timeline. If
+/// *doc* is not \c nullptr, undos will be added. Returns the number of
+/// nodes that have been processed.
+/// ***************************************************************************
+static const NBIT g_hideBits[] = {
+  NBIT_OHIDE, NBIT_TL1_HIDE, NBIT_TL2_HIDE, NBIT_TL3_HIDE, NBIT_TL4_HIDE, NBIT_THIDE,
+};
+
+/// ***************************************************************************
+/// Hides or reveals a single node.
+/// ***************************************************************************
+static void HideNode(BaseList2D* node, Bool hide)
+{
+  const NBITCONTROL control = (hide ? NBITCONTROL_SET : NBITCONTROL_CLEAR);
+  for (NBIT bit : g_hideBits)
+    node->ChangeNBit(bit, control);
+  node->DelBit(BIT_ACTIVE);
 }
 
+/// ***************************************************************************
+/// Returns the bits of *node* that #HideNode() changes, packed into a
+/// single value for #SetHideState().
+/// ***************************************************************************
+static LONG GetHideState(BaseList2D* node)
+{
+  LONG state = 0;
+  for (size_t i = 0; i < sizeof(g_hideBits) / sizeof(g_hideBits[0]); ++i)
+  {
+    if (node->GetNBit(g_hideBits[i]))
+      state |= 1 << i;
+  }
+  if (node->GetBit(BIT_ACTIVE))
+    state |= 1 << 16;
+  return state;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+static void SetHideState(BaseList2D* node, LONG state)
+{
+  for (size_t i = 0; i < sizeof(g_hideBits) / sizeof(g_hideBits[0]); ++i)
+    node->ChangeNBit(g_hideBits[i], (state & (1 << i)) ? NBITCONTROL_SET : NBITCONTROL_CLEAR);
+  if (state & (1 << 16))
+    node->SetBit(BIT_ACTIVE);
+  else
+    node->DelBit(BIT_ACTIVE);
+}
 
 /// ***************************************************************************
-/// This function recursive hides or unhides a node and all its following
-/// nodes in the same hierarchy level and below object manager and timeline.
-/// Only direct children are hidden or revealed, no other branches.
-/// @param[in] root The node to start with.
-/// @param[in] hide \c true if the hierarchy should be hidden, \c false
-///     if it should be revealed by this function.
-/// @param[in] doc The BaseDocument to add undos to, if desired. Pass
-///     \c nullptr if no undos should be created.
-/// @param[in] sameLevel If \c true (default), all objects following *root*
-///     in the hierarchy will also be processed by this function.
 /// ***************************************************************************
-static void HideHierarchy(BaseList2D* root, Bool hide, BaseDocument* doc, Bool sameLevel=true)
+static LONG ApplyHideNodes(const std::vector<BaseList2D*>& nodes, Bool hide, BaseDocument* doc)
 {
-  while (root)
+  TRACE_SCOPE("ApplyHideNodes");
+  for (BaseList2D* node : nodes)
   {
     if (doc)
-      doc->AddUndo(UNDOTYPE_BITS, root);
-    const NBITCONTROL control = (hide ? NBITCONTROL_SET : NBITCONTROL_CLEAR);
-    root->ChangeNBit(NBIT_OHIDE, control);
-    root->ChangeNBit(NBIT_TL1_HIDE, control);
-    root->ChangeNBit(NBIT_TL2_HIDE, control);
-    root->ChangeNBit(NBIT_TL3_HIDE, control);
-    root->ChangeNBit(NBIT_TL4_HIDE, control);
-    root->ChangeNBit(NBIT_THIDE, control);
-    root->DelBit(BIT_ACTIVE);
-
-    Bool hideChildren = true;
-    if (root->IsInstanceOf(Obase))
-    {
-      BaseObject* op = static_cast<BaseObject*>(root);
-      BaseContainer* bc = op->GetDataInstance();
-      CriticalAssert(bc);
-
-      if (!IsEmpty(bc->GetString(CONTAINEROBJECT_PROTECTIONHASH)))
-        // Don't modify the hierarchy of "protected" Null-Objects.
-        hideChildren = false;
-      else if (ContainerIsProtected(op))
-        // Don't modify the hierarchy of protected Containers.
-        hideChildren = false;
+      doc->AddUndo(UNDOTYPE_BITS, node);
+    HideNode(node, hide);
+  }
+  return (LONG) nodes.size();
+}
+
+/// ***************************************************************************
+/// Creates a plan context for the hierarchy below *op*. The protection
+/// state is snapshotted from the registry so that the workers don't
+/// need to lock it. *snapshot* must outlive the context.
+/// ***************************************************************************
+static HidePlanContext MakeHidePlanContext(BaseObject* op, Bool materials,
+    std::unordered_set<BaseObject*>& snapshot)
+{
+  HidePlanContext ctx;
+  ctx.doc = op->GetDocument();
+  ctx.materials = materials;
+  ctx.protectedSet = nullptr;
+  if (ctx.doc)
+  {
+    std::vector<ContainerInfo> containers;
+    ContainerFindAll(ctx.doc, &containers);
+    for (const ContainerInfo& info : containers)
+    {
+      if (info.isProtected)
+        snapshot.insert(info.op);
     }
+    ctx.protectedSet = &snapshot;
+  }
+  return ctx;
+}
 
-    if (hideChildren)
-      HideHierarchy(static_cast<BaseList2D*>(root->GetDown()), hide, doc);
+/// ***************************************************************************
+/// The apply phase of an interactive protect or unprotect, spread over
+/// successive event loop ticks by #HideJobMessage so that the UI stays
+/// responsive on large rigs. The original bits of every changed node are
+/// kept so that a cancelled job can be rolled back, and so that a
+/// finished job can record its undo. The plan is redone when the
+/// hierarchy of the document changes between two slices.
+/// ***************************************************************************
+struct HideJob
+{
+  struct LinkDeleter
+  {
+    void operator () (BaseLink* link) const { BaseLink::Free(link); }
+  };
+
+  /// A node that the job has changed. The link tells if the node is
+  /// still alive, a new node may have been allocated at its address.
+  struct Change
+  {
+    std::unique_ptr<BaseLink, LinkDeleter> link;
+    LONG state;  ///< Bits from before the job, see GetHideState().
+  };
+
+  Bool hide;
+  Bool tags;
+  Bool materials;
+  Bool wasProtected;      ///< Protection state to restore on cancel.
+  String wasHash;
+  BaseDocument* doc;      ///< Document that #nodes were planned in.
+  UInt32 hdirty;          ///< Hierarchy dirty count of #doc at plan time.
+  std::vector<BaseList2D*> nodes;
+  size_t next;
+  std::vector<Change> changes;
+  /// Maps the live nodes of #changes to their index. Rebuilt from the
+  /// links whenever the plan is redone.
+  std::unordered_map<BaseList2D*, size_t> changed;
+};
+
+enum
+{
+  /// Plans with fewer nodes are applied immediately, with undo.
+  HIDEJOB_MIN_NODES = 5000,
+
+  /// Time budget of a single slice in milliseconds, half a frame at 60 fps.
+  HIDEJOB_SLICE_MS = 8,
+};
+
+/// ***************************************************************************
+/// ***************************************************************************
+static UInt32 GetHideJobDirty(BaseDocument* doc)
+{
+  if (!doc) return 0;
+  return doc->GetHDirty(HDIRTYFLAGS_OBJECT_HIERARCHY)
+      + doc->GetHDirty(HDIRTYFLAGS_TAG)
+      + doc->GetHDirty(HDIRTYFLAGS_MATERIAL);
+}
+
+/// The containers that have a #HideJob running. Only accessed from the
+/// main thread.
+static std::vector<BaseObject*> g_hideJobs;
+
+
+/// ***************************************************************************
+/// Hides or unhides all objects below *root* in the viewport. Used while
+/// a proxy is drawn in place of the container contents.
+/// ***************************************************************************
+static void HideInEditor(BaseObject* root, Bool hide, BaseDocument* doc)
+{
+  const NBITCONTROL control = (hide ? NBITCONTROL_SET : NBITCONTROL_CLEAR);
+  for (NodeIterator<BaseObject> it(root->GetDown(), root); it; ++it)
+  {
+    if (doc)
+      doc->AddUndo(UNDOTYPE_BITS, *it);
+    it->ChangeNBit(NBIT_EHIDE, control);
+  }
+}
+
+
+/// ***************************************************************************
+/// Appends the 12 edges of the box *bbmin* to *bbmax* to *lines*.
+/// ***************************************************************************
+static void AddBoxLines(std::vector<Vector>& lines, const Vector& bbmin, const Vector& bbmax)
+{
+  const Vector c[8] = {
+    Vector(bbmin.x, bbmin.y, bbmin.z), Vector(bbmax.x, bbmin.y, bbmin.z),
+    Vector(bbmax.x, bbmin.y, bbmax.z), Vector(bbmin.x, bbmin.y, bbmax.z),
+    Vector(bbmin.x, bbmax.y, bbmin.z), Vector(bbmax.x, bbmax.y, bbmin.z),
+    Vector(bbmax.x, bbmax.y, bbmax.z), Vector(bbmin.x, bbmax.y, bbmax.z),
+  };
+  for (LONG i = 0; i < 4; ++i)
+  {
+    lines.push_back(c[i]); lines.push_back(c[(i + 1) % 4]);
+    lines.push_back(c[i + 4]); lines.push_back(c[(i + 1) % 4 + 4]);
+    lines.push_back(c[i]); lines.push_back(c[i + 4]);
+  }
+}
 
-    if (!sameLevel) break;
-    root = root->GetNext();
+
+/// ***************************************************************************
+/// Appends the box of *bbox* to *lines* if it is initialized.
+/// ***************************************************************************
+static void AddBoxLines(std::vector<Vector>& lines, const AABB& bbox)
+{
+  if (!bbox.IsInitialized()) return;
+  const Vector mp = bbox.GetMidpoint();
+  const Vector rad = bbox.GetSize();
+  AddBoxLines(lines, mp - rad, mp + rad);
+}
+
+
+/// ***************************************************************************
+/// Returns true if *op* is a generator whose output only depends on its
+/// own parameters, ie. one of the built-in primitives.
+/// ***************************************************************************
+static Bool IsPrimitiveGenerator(BaseObject* op)
+{
+  switch (op->GetType())
+  {
+    case Ocube: case Osphere: case Ocylinder: case Ocone: case Otorus:
+    case Oplane: case Odisc: case Opyramid: case Otube: case Ocapsule:
+    case Ooiltank: case Ofigure: case Oplatonic: case Orelief: case Osinglepoly:
+    case Osplinecircle: case Osplinerectangle: case Osplinearc: case Osplinehelix:
+    case Osplinestar: case Osplinenside: case Osplineflower: case Osplinecogwheel:
+    case Osplinecycloid: case Osplineprofile: case Osplinetext:
+      return true;
   }
+  return false;
 }
 
 
 /// ***************************************************************************
-/// This function hides or unhides all materials used by the object *op*.
-/// If *doc* is not \c nullptr, undos will be added.
+/// Returns true if something in *doc* or below *op* could find the
+/// children of *op* without a link that CollectLinks() sees: expression
+/// tags (XPresso, Python and C.O.F.F.E.E. search by name or keep their
+/// references elsewhere) anywhere in the scene, or generators other
+/// than primitives below *op*.
 /// ***************************************************************************
-static void HideMaterials(BaseObject* op, Bool hide, BaseDocument* doc)
+static Bool HasHiddenReferences(BaseObject* op, BaseDocument* doc)
 {
-  BaseTag* tag = op->GetFirstTag();
-  GeData data;
-  while (tag)
+  for (NodeIterator<BaseObject> it(doc->GetFirstObject()); it; ++it)
   {
-    if (tag->GetType() == Ttexture && tag->GetParameter(TEXTURETAG_MATERIAL, data, DESCFLAGS_GET_0))
+    for (BaseTag* tag = it->GetFirstTag(); tag; tag = tag->GetNext())
     {
-      BaseMaterial* mat = static_cast<BaseMaterial*>(data.GetLink(doc, Mbase));
-      if (mat) HideHierarchy(mat, hide, doc, false);
+      if (tag->GetInfo() & TAG_EXPRESSION) return true;
     }
-    tag = tag->GetNext();
   }
+  for (NodeIterator<BaseObject> it(op->GetDown(), op); it; ++it)
+  {
+    if ((it->GetInfo() & OBJECT_GENERATOR) && !IsPrimitiveGenerator(*it))
+      return true;
+  }
+  return false;
+}
+
+
+/// ***************************************************************************
+/// Returns true if *op* and all of its children are nulls or splines
+/// without tags that no other node links to. Such branches do not
+/// contribute to the rendered image once they are not inputs of a
+/// generator.
+/// ***************************************************************************
+static Bool IsHelperBranch(BaseObject* op, const std::set<BaseList2D*>& refs)
+{
+  if (op->GetFirstTag() || refs.count(op)) return false;
+  if (op->GetType() != Onull && !(op->GetInfo() & OBJECT_ISSPLINE)) return false;
+  for (BaseObject* child = op->GetDown(); child; child = child->GetNext())
+  {
+    if (!IsHelperBranch(child, refs)) return false;
+  }
+  return true;
+}
+
+
+/// ***************************************************************************
+/// Removes all helper branches below *op*. The children of generators
+/// are never touched since they are the generator's input. Returns the
+/// number of removed branches.
+/// ***************************************************************************
+static LONG StripHelperBranches(BaseObject* op, const std::set<BaseList2D*>& refs)
+{
+  LONG count = 0;
   BaseObject* child = op->GetDown();
-  while (child) {
-    HideMaterials(child, hide, doc);
-    child = child->GetNext();
+  while (child)
+  {
+    BaseObject* next = child->GetNext();
+    if (IsHelperBranch(child, refs))
+    {
+      child->Remove();
+      BaseObject::Free(child);
+      ++count;
+    }
+    else if (!(child->GetInfo() & OBJECT_GENERATOR))
+      count += StripHelperBranches(child, refs);
+    child = next;
   }
+  return count;
 }
 
 
@@ -121,15 +524,103 @@ class ContainerObject : public ObjectData
   BaseBitmap* m_customIcon;
   Bool m_protected;
   String m_protectionHash;
+  PerfCounters m_counters;
+  Int64 m_iconBytes;
+
+  /// True while the children are hidden in the viewport and the proxy
+  /// is drawn instead. The proxy lines are in container space and are
+  /// only rebuilt when #m_proxyChecksum changes.
+  Bool m_proxyActive;
+  std::vector<Vector> m_proxyLines;
+  UInt32 m_proxyChecksum;
+
+  /// The bounding box in container space as computed by the last call
+  /// to GetDimension().
+  Vector m_bboxMp;
+  Vector m_bboxRad;
+
+  /// Mirrors NRCONTAINER_GENERATOR_CHECKMARK so that _hook_GetInfo()
+  /// does not need a description lookup.
+  Bool m_generatorCheckmark;
+
+  /// While frozen, the children are suspended and #m_frozen is returned
+  /// from GetVirtualObjects(). #m_frozenChecksum is the dirty checksum of
+  /// the children after freezing, 0 if it must be picked up on the next
+  /// evaluation (after loading or copying the object).
+  FrozenMesh m_frozen;
+  Bool m_freezeActive;
+  Bool m_freezeStale;
+  UInt32 m_frozenChecksum;
+
+  FingerprintCache m_fingerprint;
+
+  /// Dirty checksum of the instance master when the cache was built.
+  UInt32 m_masterDirty;
+
+  /// Set while an interactive protect or unprotect is in progress. The
+  /// container does not accept edits until the job is done.
+  HideJob* m_hideJob;
+
+  /// While packed, the children only exist in serialized form in
+  /// #m_packed and are not part of the document.
+  PackedHierarchy m_packed;
+
+  /// Bounding boxes by frame, used by GetDimension() if
+  /// NRCONTAINER_MOTION_CACHE is enabled.
+  MotionBoundsCache m_motion;
+
+  /// Index of the active level of detail among the children with a
+  /// Container LOD tag, -1 if all levels are active. Depends on the view
+  /// and is never saved, the other levels are touched in
+  /// GetVirtualObjects() so that they are neither drawn nor rendered.
+  LONG m_lodLevel;
+
+  /// Incremented whenever #m_bboxMp or #m_bboxRad change, so that the
+  /// spatial index can tell which leaves to move when it is queried.
+  UInt32 m_boundsStamp;
+
+  friend LONG _hook_GetInfo(GeListNode*);
   friend Bool ContainerIsProtected(BaseObject*, String*);
   friend Bool ContainerProtect(BaseObject*, String const&, String, Bool);
+  friend Bool ContainerUnprotect(BaseObject*, String const&);
+  friend Bool ContainerHideContents(BaseObject*, BaseDocument*);
+  friend Bool ContainerSetIcon(BaseObject*, BaseBitmap const*);
+  friend BaseBitmap const* ContainerGetIcon(BaseObject*);
+  friend Bool ContainerGetFingerprint(BaseObject*, Fingerprint*);
+  friend Bool ContainerFreeze(BaseObject*, Bool, BaseDocument*);
+  friend Bool ContainerIsFrozen(BaseObject*, Bool*);
+  friend Bool ContainerIsBusy(BaseObject*);
+  friend Bool ContainerPack(BaseObject*, Bool, BaseDocument*, Bool);
+  friend Bool ContainerIsPacked(BaseObject*);
+  friend Bool ContainerGetWorldBounds(BaseObject*, Vector*, Vector*);
+  friend UInt32 ContainerGetSpatialStamp(BaseObject*);
+  friend Int64 ContainerGetDataSize(BaseObject*);
+  friend Bool ContainerGetMotionBounds(BaseObject*, const BaseTime&, const BaseTime&, Vector*, Vector*);
+  friend class HideJobMessage;
+  friend class ContentSyncMessage;
 public:
 
+  ContainerObject()
+  : m_customIcon(nullptr), m_protected(false), m_iconBytes(0), m_proxyActive(false),
+    m_proxyChecksum(0), m_bboxMp(0.0), m_bboxRad(0.0), m_generatorCheckmark(true),
+    m_freezeActive(false), m_freezeStale(false), m_frozenChecksum(0), m_masterDirty(0),
+    m_hideJob(nullptr), m_lodLevel(-1), m_boundsStamp(0) { }
+
   static NodeData* Alloc() { return gNew(ContainerObject); }
 
+  /// Must be called after #m_customIcon changed to keep the icon
+  /// memory counters up to date.
+  void UpdateIconBytes()
+  {
+    const Int64 bytes = m_customIcon ? m_customIcon->GetMemoryInfo() : 0;
+    GlobalCounterAdd(PERFCOUNTER_ICON_BYTES, bytes - m_iconBytes);
+    m_iconBytes = bytes;
+  }
+
   /// Called from Message() for MSG_DESCRIPTION_COMMAND.
   void OnDescriptionCommand(BaseObject* op, DescriptionCommand* cmdData)
   {
+    if (m_hideJob) return;
     BaseDocument* doc = op->GetDocument();
     const AutoUndo au(doc);
     const LONG id = GetDescriptionID(cmdData)[0].id;
@@ -139,6 +630,26 @@ public:
       case NRCONTAINER_PACKUP:
         ToggleProtect(op);
         break;
+      case NRCONTAINER_FREEZE:
+        if (doc) doc->AddUndo(UNDOTYPE_CHANGE_SMALL, op);
+        Freeze(op, doc, doc);
+        EventAdd();
+        break;
+      case NRCONTAINER_UNFREEZE:
+        if (!m_freezeActive) break;
+        if (doc) doc->AddUndo(UNDOTYPE_CHANGE_SMALL, op);
+        Unfreeze(op, doc);
+        EventAdd();
+        break;
+      case NRCONTAINER_PACK:
+        if (Pack(op, doc, true)) EventAdd();
+        break;
+      case NRCONTAINER_UNPACK:
+        if (Unpack(op, doc, true)) EventAdd();
+        break;
+      case NRCONTAINER_MOTION_BAKE:
+        if (doc) BakeMotionBounds(op, doc);
+        break;
       case NRCONTAINER_ICON_LOAD:
       {
         if (m_protected) break;
@@ -179,6 +690,7 @@ public:
               m_customIcon = dest;
             }
           }
+          UpdateIconBytes();
         }
         break;
       }
@@ -191,6 +703,7 @@ public:
           // on the next MSG_GETCUSTOMICON message, because Cinema
           // still references this bitmap.
           BaseBitmap::Free(m_customIcon);
+          UpdateIconBytes();
         }
         break;
       }
@@ -200,6 +713,7 @@ public:
   /// Called from Message() for MSG_GETCUSTOMICON.
   void OnGetCustomIcon(BaseObject* op, GetCustomIconData* data)
   {
+    TRACE_SCOPE("OnGetCustomIcon");
     IconData* dIcon = data->dat;
     BaseBitmap* bmp;
     LONG xoff, yoff, xdim, ydim;
@@ -218,6 +732,7 @@ public:
       {
         bmp = m_customIcon->GetClone();
       }
+      CounterAdd(m_counters, PERFCOUNTER_ICON_COPIES, 1);
       xoff = 0;
       yoff = 0;
       xdim = bmp->GetBw();
@@ -261,17 +776,14 @@ public:
   /// the object icon). Toggles the protection state of the container.
   void ToggleProtect(BaseObject* op)
   {
+    TRACE_SCOPE("ToggleProtect");
+    if (m_hideJob) return;
     BaseDocument* doc = op->GetDocument();
-    if (doc)
-    {
-      doc->StartUndo();
-      doc->AddUndo(UNDOTYPE_CHANGE_SMALL, op);
-      doc->EndUndo();
-    }
-
     BaseContainer const* bc = op->GetDataInstance();
     if (!bc) return;
 
+    const Bool wasProtected = m_protected;
+    const String wasHash = m_protectionHash;
     if (!m_protected)
     {
       String password;
@@ -279,8 +791,6 @@ public:
       String hashed = HashString(password);
       m_protected = true;
       m_protectionHash = hashed;
-
-      HideNodes(op, doc, true);
     }
     else
     {
@@ -293,60 +803,737 @@ public:
       }
       else if (PasswordDialog(&password, true, true))
       {
-        unlock = (m_protectionHash == HashString(password));
-        if (!unlock)
-          MessageDialog(GeLoadString(IDS_PASSWORD_INVALID));
+        unlock = (m_protectionHash == HashString(password));
+        if (!unlock)
+          MessageDialog(GeLoadString(IDS_PASSWORD_INVALID));
+      }
+      if (!unlock) return;
+      m_protected = false;
+    }
+    ContainerRegistryUpdate(op);
+
+    // A #HideJob records the undo for the container and its nodes in
+    // one step when it ends.
+    if (doc) doc->StartUndo();
+    if (!HideNodes(op, doc, m_protected, true) && doc)
+      AddProtectionUndo(op, doc, wasProtected, wasHash);
+    if (doc) doc->EndUndo();
+
+    op->Message(MSG_CHANGE);
+    op->SetDirty(DIRTYFLAGS_DESCRIPTION);
+    EventAdd();
+  }
+
+  /// Adds an undo for the container that restores *wasProtected* and
+  /// *wasHash* instead of the current protection state.
+  void AddProtectionUndo(BaseObject* op, BaseDocument* doc, Bool wasProtected,
+      const String& wasHash)
+  {
+    const Bool isProtected = m_protected;
+    const String isHash = m_protectionHash;
+    m_protected = wasProtected;
+    m_protectionHash = wasHash;
+    doc->AddUndo(UNDOTYPE_CHANGE_SMALL, op);
+    m_protected = isProtected;
+    m_protectionHash = isHash;
+  }
+
+  /// Called to hide/unhide the container object contents. If *async*
+  /// is true and the plan is large, the nodes are changed in time slices
+  /// by a #HideJob instead and true is returned. The job takes the
+  /// current protection state as the result, restores the opposite one
+  /// if it is cancelled and adds the undo when it is done.
+  Bool HideNodes(BaseObject* op, BaseDocument* doc, Bool hide, Bool async=false)
+  {
+    TRACE_SCOPE("HideNodes");
+    BaseContainer* bc = op->GetDataInstance();
+    CriticalAssert(bc != nullptr);
+
+    // Revealing always includes tags and materials, their options may
+    // have changed since the container was packed up.
+    const Bool tags = !hide || bc->GetBool(NRCONTAINER_HIDE_TAGS);
+    const Bool materials = !hide || bc->GetBool(NRCONTAINER_HIDE_MATERIALS);
+    std::unordered_set<BaseObject*> snapshot;
+    const HidePlanContext ctx = MakeHidePlanContext(op, materials, snapshot);
+    std::vector<BaseList2D*> nodes;
+    PlanHideNodes(op, tags, ctx, nodes);
+
+    if (async && doc && nodes.size() >= HIDEJOB_MIN_NODES)
+    {
+      m_hideJob = gNew(HideJob);
+      if (m_hideJob)
+      {
+        m_hideJob->hide = hide;
+        m_hideJob->tags = tags;
+        m_hideJob->materials = materials;
+        m_hideJob->wasProtected = !m_protected;
+        m_hideJob->wasHash = m_protectionHash;
+        m_hideJob->doc = doc;
+        m_hideJob->hdirty = GetHideJobDirty(doc);
+        m_hideJob->nodes.swap(nodes);
+        m_hideJob->next = 0;
+        g_hideJobs.push_back(op);
+        SpecialEventAdd(CONTAINEROBJECT_MSG_HIDESLICE);
+        return true;
+      }
+    }
+
+    const LONG count = ApplyHideNodes(nodes, hide, doc);
+    CounterAdd(m_counters, PERFCOUNTER_NODES_FLIPPED, count);
+    UpdateProxyVisibility(op, doc);
+    return false;
+  }
+
+  /// Changes the nodes of the running #HideJob until *deadline* (in
+  /// GeGetMilliSeconds() time) is reached. Returns true if the job has
+  /// processed all nodes.
+  Bool StepHideJob(BaseObject* op, Float deadline)
+  {
+    TRACE_SCOPE("StepHideJob");
+    HideJob* job = m_hideJob;
+    if (!job) return true;
+
+    BaseDocument* doc = op->GetDocument();
+    const UInt32 hdirty = GetHideJobDirty(doc);
+    if (doc != job->doc || hdirty != job->hdirty)
+    {
+      // Nodes may have been removed, the pointers in the old plan and
+      // in the map of changed nodes must not be touched. Nodes that are
+      // already done are found through their links and skipped below.
+      std::unordered_set<BaseObject*> snapshot;
+      const HidePlanContext ctx = MakeHidePlanContext(op, job->materials, snapshot);
+      job->nodes.clear();
+      PlanHideNodes(op, job->tags, ctx, job->nodes);
+      job->next = 0;
+      job->doc = doc;
+      job->hdirty = hdirty;
+      job->changed.clear();
+      for (size_t i = 0; i < job->changes.size(); ++i)
+      {
+        BaseList2D* node = GetChangedNode(job->changes[i], doc);
+        if (node) job->changed[node] = i;
+      }
+    }
+
+    LONG count = 0;
+    while (job->next < job->nodes.size())
+    {
+      BaseList2D* node = job->nodes[job->next++];
+      if (job->changed.insert(std::make_pair(node, job->changes.size())).second)
+      {
+        HideJob::Change change;
+        change.link.reset(BaseLink::Alloc());
+        if (change.link) change.link->SetLink(node);
+        change.state = GetHideState(node);
+        job->changes.push_back(std::move(change));
+        HideNode(node, job->hide);
+        ++count;
+      }
+      if ((count & 0xff) == 0 && GeGetMilliSeconds() >= deadline)
+        break;
+    }
+    CounterAdd(m_counters, PERFCOUNTER_NODES_FLIPPED, count);
+    return job->next >= job->nodes.size();
+  }
+
+  /// Returns the node of *change* if it is still alive in *doc*.
+  static BaseList2D* GetChangedNode(const HideJob::Change& change, BaseDocument* doc)
+  {
+    if (!change.link || !doc) return nullptr;
+    return change.link->GetLink(doc);
+  }
+
+  /// Ends the running #HideJob. If *cancel* is true, the changed nodes
+  /// are restored and the protection state from before the job is set.
+  /// Otherwise the job is recorded as a single undo step.
+  void EndHideJob(BaseObject* op, Bool cancel)
+  {
+    TRACE_SCOPE("EndHideJob");
+    HideJob* job = m_hideJob;
+    if (!job) return;
+    m_hideJob = nullptr;
+    g_hideJobs.erase(std::remove(g_hideJobs.begin(), g_hideJobs.end(), op), g_hideJobs.end());
+
+    // The nodes are resolved through their links, pointers may be stale
+    // if the hierarchy changed since the last slice.
+    BaseDocument* doc = op->GetDocument();
+    if (cancel)
+    {
+      for (const HideJob::Change& change : job->changes)
+      {
+        BaseList2D* node = GetChangedNode(change, doc);
+        if (node) SetHideState(node, change.state);
+      }
+      m_protected = job->wasProtected;
+      m_protectionHash = job->wasHash;
+      ContainerRegistryUpdate(op);
+    }
+    else if (doc)
+    {
+      // The slices changed the nodes without undo. Put the bits from
+      // before the job back for the time it takes to record them.
+      doc->StartUndo();
+      AddProtectionUndo(op, doc, job->wasProtected, job->wasHash);
+      for (const HideJob::Change& change : job->changes)
+      {
+        BaseList2D* node = GetChangedNode(change, doc);
+        if (!node) continue;
+        const LONG state = GetHideState(node);
+        SetHideState(node, change.state);
+        doc->AddUndo(UNDOTYPE_BITS, node);
+        SetHideState(node, state);
+      }
+      doc->EndUndo();
+    }
+
+    gDelete(job);
+    UpdateProxyVisibility(op, op->GetDocument());
+    op->Message(MSG_CHANGE);
+    op->SetDirty(DIRTYFLAGS_DESCRIPTION);
+  }
+
+  /// Picks the active level of detail from the distance of the camera
+  /// of *bd* or the projected size of the container. Levels are the
+  /// direct children with a Container LOD tag; the first one in the
+  /// hierarchy whose threshold is satisfied wins, the last one is used
+  /// if none is. Only #m_lodLevel is changed, the document is left
+  /// alone. Must be called on the main thread, see #ContentSyncMessage.
+  /// Returns true if the level changed.
+  Bool UpdateLod(BaseObject* op, BaseDocument* doc, BaseDraw* bd)
+  {
+    if (!bd) return false;
+    BaseObject* cam = bd->GetSceneCamera(doc);
+    if (!cam) cam = bd->GetEditorCamera();
+    if (!cam) return false;
+
+    const Matrix mg = op->GetMg();
+    const Matrix cmg = cam->GetMg();
+    const Vector center = mg * m_bboxMp;
+    const Float radius = (mg.sqmat * m_bboxRad).GetLength();
+    Float distance = (cmg.off - center).GetLength() - radius;
+    if (distance < 0.0) distance = 0.0;
+    const Vector s1 = bd->WS(center);
+    const Vector s2 = bd->WS(center + cmg.sqmat.v1.GetNormalized() * radius);
+    const Float screenSize = 2.0 * Vector(s2.x - s1.x, s2.y - s1.y, 0.0).GetLength();
+
+    LONG active = -1;
+    LONG count = 0;
+    for (BaseObject* child = op->GetDown(); child; child = child->GetNext())
+    {
+      BaseTag* tag = child->GetTag(Tcontainerlod);
+      if (!tag) continue;
+      const LONG index = count++;
+      if (active >= 0) continue;
+      const BaseContainer* bc = tag->GetDataInstance();
+      if (!bc) continue;
+      if (bc->GetInt32(CONTAINERLOD_MODE) == CONTAINERLOD_MODE_SCREENSIZE)
+      {
+        if (screenSize >= bc->GetFloat(CONTAINERLOD_SCREENSIZE))
+          active = index;
+      }
+      else if (distance <= bc->GetFloat(CONTAINERLOD_DISTANCE))
+        active = index;
+    }
+    if (active < 0) active = count - 1;
+
+    if (active == m_lodLevel) return false;
+    m_lodLevel = active;
+    return true;
+  }
+
+  /// Calls *fn* for every direct child of *op* that is a level of
+  /// detail other than #m_lodLevel.
+  template <typename F>
+  void ForEachInactiveLevel(BaseObject* op, F&& fn) const
+  {
+    if (m_lodLevel < 0) return;
+    LONG index = 0;
+    for (BaseObject* child = op->GetDown(); child; child = child->GetNext())
+    {
+      if (!child->GetTag(Tcontainerlod)) continue;
+      if (index++ != m_lodLevel)
+        fn(child);
+    }
+  }
+
+  /// Returns true if a child of *op* is not suspended by the user yet.
+  static Bool HasResumedChildren(BaseObject* op)
+  {
+    for (BaseObject* child = op->GetDown(); child; child = child->GetNext())
+    {
+      if (!(GetSuspendReasons(child) & SUSPENDREASON_USER)) return true;
+    }
+    return false;
+  }
+
+  /// Suspends or resumes all children of *op* on behalf of the user.
+  /// Children that are already in the requested state are skipped, so
+  /// this also picks up children that were added while suspended.
+  void SuspendContents(BaseObject* op, Bool suspend, BaseDocument* doc)
+  {
+    TRACE_SCOPE("SuspendContents");
+    for (BaseObject* child = op->GetDown(); child; child = child->GetNext())
+    {
+      if (((GetSuspendReasons(child) & SUSPENDREASON_USER) != 0) == suspend) continue;
+      SuspendHierarchy(child, SUSPENDREASON_USER, suspend, doc);
+    }
+  }
+
+  /// Called from Message() for MSG_MULTI_RENDERNOTIFICATION. Removes
+  /// children from the render document that can not contribute to the
+  /// image: all of them if the container is suspended or serves a frozen
+  /// mesh, otherwise the unreferenced null and spline branches. Only
+  /// runs if the user enabled it on this container, and never if an
+  /// expression or generator could reference the children unseen.
+  void StripForRender(BaseObject* op, RenderNotificationData* data)
+  {
+    BaseContainer* bc = op->GetDataInstance();
+    if (!data || !data->start || !bc || !bc->GetBool(NRCONTAINER_RENDER_STRIP)) return;
+    BaseDocument* doc = op->GetDocument();
+    if (!doc || doc != data->doc || doc == GetActiveDocument()) return;
+    TRACE_SCOPE("StripForRender");
+    if (HasHiddenReferences(op, doc)) return;
+
+    LONG count = 0;
+    const Bool frozen = m_freezeActive && !m_freezeStale && !m_frozen.IsEmpty();
+    if (frozen || bc->GetBool(NRCONTAINER_SUSPEND))
+    {
+      while (BaseObject* child = op->GetDown())
+      {
+        child->Remove();
+        BaseObject::Free(child);
+        ++count;
+      }
+    }
+    else
+    {
+      // Links can point into the container from anywhere in the scene.
+      std::set<BaseList2D*> refs;
+      for (NodeIterator<BaseObject> it(doc->GetFirstObject()); it; ++it)
+      {
+        CollectLinks(it->GetDataInstance(), doc, refs);
+        for (BaseTag* tag = it->GetFirstTag(); tag; tag = tag->GetNext())
+          CollectLinks(tag->GetDataInstance(), doc, refs);
+      }
+      count = StripHelperBranches(op, refs);
+    }
+
+    // The removed children change the checksum, the frozen mesh is
+    // still valid for this document.
+    if (count > 0)
+      m_frozenChecksum = 0;
+  }
+
+  /// Hides the children in the viewport if the container is protected
+  /// and a proxy mode is selected, or reveals them otherwise.
+  void UpdateProxyVisibility(BaseObject* op, BaseDocument* doc)
+  {
+    BaseContainer* bc = op->GetDataInstance();
+    CriticalAssert(bc != nullptr);
+    const Bool active = m_protected &&
+      bc->GetInt32(NRCONTAINER_PROXY_MODE) != NRCONTAINER_PROXY_MODE_OFF;
+    if (active == m_proxyActive) return;
+    HideInEditor(op, active, doc);
+    m_proxyActive = active;
+    m_proxyLines.clear();
+  }
+
+  /// Rebuilds #m_proxyLines if the children or the proxy settings
+  /// changed since the last call.
+  void UpdateProxy(BaseObject* op)
+  {
+    BaseContainer* bc = op->GetDataInstance();
+    CriticalAssert(bc != nullptr);
+    const LONG mode = bc->GetInt32(NRCONTAINER_PROXY_MODE);
+    BaseObject* proxy = nullptr;
+    if (mode == NRCONTAINER_PROXY_MODE_OBJECT)
+      proxy = static_cast<BaseObject*>(bc->GetLink(NRCONTAINER_PROXY_OBJECT, op->GetDocument(), Opolygon));
+
+    UInt32 checksum = GetHierarchyDirty(op, DIRTYFLAGS_DATA | DIRTYFLAGS_MATRIX | DIRTYFLAGS_CACHE);
+    checksum = checksum * 31 + op->GetDirty(DIRTYFLAGS_DATA | DIRTYFLAGS_MATRIX);
+    if (proxy)
+      checksum = checksum * 31 + proxy->GetDirty(DIRTYFLAGS_DATA | DIRTYFLAGS_MATRIX);
+    if (checksum == m_proxyChecksum && !m_proxyLines.empty())
+      return;
+    m_proxyChecksum = checksum;
+    m_proxyLines.clear();
+
+    const Matrix img = ~op->GetMg();
+    switch (mode)
+    {
+      case NRCONTAINER_PROXY_MODE_BOX:
+      {
+        AABB bbox(img);
+        for (NodeIterator<BaseObject> it(op->GetDown(), op); it; ++it)
+        {
+          if (it->GetInfo() & OBJECT_GENERATOR && !IsControlledByGenerator(*it))
+            bbox.Expand(*it, it->GetMg(), false);
+        }
+        AddBoxLines(m_proxyLines, bbox);
+        break;
+      }
+      case NRCONTAINER_PROXY_MODE_CHILDBOXES:
+      {
+        for (BaseObject* child = op->GetDown(); child; child = child->GetNext())
+        {
+          AABB bbox(img);
+          bbox.Expand(child, child->GetMg(), true);
+          AddBoxLines(m_proxyLines, bbox);
+        }
+        break;
+      }
+      case NRCONTAINER_PROXY_MODE_OBJECT:
+      {
+        if (!proxy) break;
+        PolygonObject* poly = static_cast<PolygonObject*>(proxy);
+        const Vector* points = poly->GetPointR();
+        const CPolygon* polys = poly->GetPolygonR();
+        const LONG pcnt = poly->GetPointCount();
+        if (!points || !polys) break;
+        const Matrix m = img * proxy->GetMg();
+        for (LONG i = 0; i < poly->GetPolygonCount(); ++i)
+        {
+          const CPolygon& p = polys[i];
+          const LONG idx[4] = { p.a, p.b, p.c, p.d };
+          const LONG n = (p.c == p.d) ? 3 : 4;
+          for (LONG j = 0; j < n; ++j)
+          {
+            const LONG a = idx[j], b = idx[(j + 1) % n];
+            if (a >= pcnt || b >= pcnt) continue;
+            m_proxyLines.push_back(m * points[a]);
+            m_proxyLines.push_back(m * points[b]);
+          }
+        }
+        break;
+      }
+    }
+  }
+
+  /// Evaluates the children of *op* in *doc*, merges their caches into
+  /// #m_frozen and suspends them. *undoDoc* receives the undos for the
+  /// suspended nodes, pass \c nullptr if none should be created.
+  Bool Freeze(BaseObject* op, BaseDocument* doc, BaseDocument* undoDoc)
+  {
+    TRACE_SCOPE("Freeze");
+    if (!doc) return false;
+
+    // The caches of suspended children are not up to date, wake them
+    // and let the document build them.
+    m_freezeActive = false;
+    for (BaseObject* child = op->GetDown(); child; child = child->GetNext())
+      SuspendHierarchy(child, SUSPENDREASON_FREEZE, false, undoDoc);
+    doc->ExecutePasses(nullptr, false, true, true, BUILDFLAGS_0);
+
+    m_frozen.Build(op);
+    for (BaseObject* child = op->GetDown(); child; child = child->GetNext())
+      SuspendHierarchy(child, SUSPENDREASON_FREEZE, true, undoDoc);
+
+    m_freezeActive = true;
+    m_freezeStale = false;
+    m_frozenChecksum = GetHierarchyDirty(op, DIRTYFLAGS_DATA | DIRTYFLAGS_MATRIX, true);
+    op->SetDirty(DIRTYFLAGS_DATA);
+    return true;
+  }
+
+  /// Resumes the children of *op* and frees the frozen mesh.
+  void Unfreeze(BaseObject* op, BaseDocument* undoDoc)
+  {
+    TRACE_SCOPE("Unfreeze");
+    for (BaseObject* child = op->GetDown(); child; child = child->GetNext())
+      SuspendHierarchy(child, SUSPENDREASON_FREEZE, false, undoDoc);
+    m_frozen.Flush();
+    m_freezeActive = false;
+    m_freezeStale = false;
+    m_frozenChecksum = 0;
+    op->SetDirty(DIRTYFLAGS_DATA);
+  }
+
+  /// Serializes the children of *op* with their tags and materials into
+  /// #m_packed and removes the children from the document. Materials
+  /// stay in the document, they can be linked from anywhere (shaders,
+  /// XPresso, render settings) and Unpack() reuses them by name. Frozen
+  /// and busy containers can not be packed.
+  Bool Pack(BaseObject* op, BaseDocument* doc, Bool undo)
+  {
+    TRACE_SCOPE("Pack");
+    if (!m_packed.IsEmpty() || m_freezeActive || m_hideJob || !op->GetDown()) return false;
+
+    Vector mp, rad;
+    GetDimension(op, &mp, &rad);
+    PackedHierarchy packed;
+    if (!packed.Store(op)) return false;
+    packed.SetBounds(mp, rad);
+
+    if (doc && undo) doc->AddUndo(UNDOTYPE_CHANGE_SMALL, op);
+    packed.CopyTo(m_packed);
+    while (BaseObject* child = op->GetDown())
+    {
+      if (doc && undo) doc->AddUndo(UNDOTYPE_DELETE, child);
+      child->Remove();
+      BaseObject::Free(child);
+    }
+    m_proxyLines.clear();
+    op->SetDirty(DIRTYFLAGS_DATA);
+    return true;
+  }
+
+  /// Inserts the packed children back under *op*.
+  Bool Unpack(BaseObject* op, BaseDocument* doc, Bool undo)
+  {
+    TRACE_SCOPE("Unpack");
+    if (m_packed.IsEmpty() || m_hideJob) return false;
+    if (doc && undo) doc->AddUndo(UNDOTYPE_CHANGE_SMALL, op);
+    if (!m_packed.Restore(op, doc, undo)) return false;
+    m_packed.Flush();
+    m_proxyLines.clear();
+    op->SetDirty(DIRTYFLAGS_DATA);
+    return true;
+  }
+
+  /// Returns true if GetDimension() may use #m_motion. Levels of detail
+  /// depend on the camera, not on the time.
+  static Bool UseMotionCache(BaseObject* op)
+  {
+    BaseContainer* bc = op->GetDataInstance();
+    return bc && bc->GetBool(NRCONTAINER_MOTION_CACHE) && !bc->GetBool(NRCONTAINER_LOD_ENABLE);
+  }
+
+  /// Plays the frame range of *doc* and fills #m_motion with the
+  /// bounding box of every frame that is not cached yet. Esc stops.
+  void BakeMotionBounds(BaseObject* op, BaseDocument* doc)
+  {
+    TRACE_SCOPE("BakeMotionBounds");
+    if (!UseMotionCache(op)) return;
+    const LONG fps = doc->GetFps();
+    const LONG first = doc->GetMinTime().GetFrame(fps);
+    const LONG last = doc->GetMaxTime().GetFrame(fps);
+    const BaseTime time = doc->GetTime();
+
+    StatusSetText(GeLoadString(IDS_STATUS_BAKINGMOTION));
+    for (LONG frame = first; frame <= last; ++frame)
+    {
+      Vector mp, rad;
+      m_motion.Validate(op, doc->GetTime().GetFrame(fps), fps);
+      if (m_motion.Lookup(frame, &mp, &rad)) continue;
+      doc->SetTime(BaseTime(frame, fps));
+      doc->ExecutePasses(nullptr, true, true, true, BUILDFLAGS_0);
+      GetDimension(op, &mp, &rad);
+      StatusSetBar((LONG) ((frame - first) * 100 / std::max<LONG>(1, last - first)));
+      BaseContainer state;
+      if (GetInputState(BFM_INPUT_KEYBOARD, KEY_ESC, state) && state.GetInt32(BFM_INPUT_VALUE))
+        break;
+    }
+    doc->SetTime(time);
+    doc->ExecutePasses(nullptr, true, true, true, BUILDFLAGS_0);
+    StatusClear();
+    EventAdd();
+  }
+
+  /// Returns the Container that *op* is an instance of. Masters that are
+  /// instances themselves are ignored to rule out cycles.
+  static BaseObject* GetInstanceMaster(BaseObject* op, BaseDocument* doc)
+  {
+    BaseContainer* bc = op->GetDataInstance();
+    if (!bc) return nullptr;
+    BaseObject* master = static_cast<BaseObject*>(bc->GetLink(NRCONTAINER_INSTANCE_MASTER, doc, Ocontainer));
+    if (!master || master == op) return nullptr;
+    BaseContainer* mbc = master->GetDataInstance();
+    if (mbc && mbc->GetLink(NRCONTAINER_INSTANCE_MASTER, doc, Ocontainer)) return nullptr;
+    return master;
+  }
+
+  /// Called from GetVirtualObjects() for containers that instance
+  /// *master*. Returns an Instance object that references the master.
+  BaseObject* GetInstance(BaseObject* op, BaseObject* master, HierarchyHelp* hh)
+  {
+    const UInt32 masterDirty = master->GetDirty(DIRTYFLAGS_DATA | DIRTYFLAGS_CACHE) * 31
+      + GetHierarchyDirty(master, DIRTYFLAGS_DATA | DIRTYFLAGS_MATRIX | DIRTYFLAGS_CACHE);
+    Bool dirty = op->CheckCache(hh) || op->IsDirty(DIRTYFLAGS_DATA) || masterDirty != m_masterDirty;
+    if (!dirty) return op->GetCache(hh);
+    m_masterDirty = masterDirty;
+
+    BaseObject* inst = BaseObject::Alloc(Oinstance);
+    if (!inst) return nullptr;
+    BaseContainer* ibc = inst->GetDataInstance();
+    ibc->SetLink(INSTANCEOBJECT_LINK, master);
+    ibc->SetInt32(INSTANCEOBJECT_RENDERINSTANCE_MODE, INSTANCEOBJECT_RENDERINSTANCE_MODE_SINGLEINSTANCE);
+    return inst;
+  }
+
+  // ObjectData Overrides
+
+  virtual BaseObject* GetVirtualObjects(BaseObject* op, HierarchyHelp* hh) override
+  {
+    // Touched objects are neither drawn nor rendered. This has to be
+    // repeated on every pass, also when the cache is reused.
+    ForEachInactiveLevel(op, [](BaseObject* level) {
+      for (NodeIterator<BaseObject> it(level, level); it; ++it)
+        it->Touch();
+    });
+
+    BaseObject* master = GetInstanceMaster(op, hh->GetDocument());
+    if (master) return GetInstance(op, master, hh);
+    if (!m_freezeActive || !m_packed.IsEmpty()) return nullptr;
+    BaseContainer* bc = op->GetDataInstance();
+    if (bc && bc->GetBool(NRCONTAINER_SUSPEND)) return nullptr;
+    TRACE_SCOPE("GetVirtualObjects");
+
+    // The frozen mesh is kept until it is rebuilt on the main thread,
+    // the cache may not be changed from here.
+    const UInt32 checksum = GetHierarchyDirty(op, DIRTYFLAGS_DATA | DIRTYFLAGS_MATRIX, true);
+    if (m_frozenChecksum == 0 && !m_frozen.IsEmpty())
+      m_frozenChecksum = checksum;
+    else if (checksum != m_frozenChecksum)
+      m_freezeStale = true;
+    if (m_freezeStale)
+      SpecialEventAdd(CONTAINEROBJECT_MSG_REFREEZE);
+
+    Bool dirty = op->CheckCache(hh) || op->IsDirty(DIRTYFLAGS_DATA);
+    if (!dirty) return op->GetCache(hh);
+    if (m_frozen.IsEmpty()) return BaseObject::Alloc(Onull);
+    return m_frozen.CreateObject(op->GetDocument());
+  }
+
+  /// Stores the bounds computed by GetDimension().
+  void SetBounds(const Vector& mp, const Vector& rad)
+  {
+    if (mp == m_bboxMp && rad == m_bboxRad) return;
+    m_bboxMp = mp;
+    m_bboxRad = rad;
+    ++m_boundsStamp;
+  }
+
+  virtual void GetDimension(BaseObject* op, Vector* mp, Vector* rad) override
+  {
+    TRACE_SCOPE("GetDimension");
+    BaseContainer* bc = op->GetDataInstance();
+    BaseObject* master = GetInstanceMaster(op, op->GetDocument());
+    if (master)
+    {
+      *mp = master->GetMp();
+      *rad = master->GetRad();
+      SetBounds(*mp, *rad);
+      CounterAdd(m_counters, PERFCOUNTER_DIMENSION_CALLS, 1);
+      return;
+    }
+    if (!m_packed.IsEmpty())
+    {
+      m_packed.GetBounds(mp, rad);
+      SetBounds(*mp, *rad);
+      CounterAdd(m_counters, PERFCOUNTER_DIMENSION_CALLS, 1);
+      return;
+    }
+    if (m_freezeActive && !m_frozen.IsEmpty() && !(bc && bc->GetBool(NRCONTAINER_SUSPEND)))
+    {
+      m_frozen.GetBounds(mp, rad);
+      SetBounds(*mp, *rad);
+      CounterAdd(m_counters, PERFCOUNTER_DIMENSION_CALLS, 1);
+      return;
+    }
+    // Only whole frames are cached, motion blur subframes are computed.
+    BaseDocument* doc = op->GetDocument();
+    Bool cacheFrame = false;
+    LONG frame = 0;
+    if (doc && UseMotionCache(op))
+    {
+      const LONG fps = doc->GetFps();
+      const BaseTime time = doc->GetTime();
+      frame = time.GetFrame(fps);
+      cacheFrame = BaseTime(frame, fps) == time;
+      if (cacheFrame)
+      {
+        m_motion.Validate(op, frame, fps);
+        if (m_motion.Lookup(frame, mp, rad))
+        {
+          SetBounds(*mp, *rad);
+          CounterAdd(m_counters, PERFCOUNTER_DIMENSION_CALLS, 1);
+          return;
+        }
       }
-      if (unlock)
+    }
+    const Float start = GeGetMilliSeconds();
+
+    // Find the Minimum/Maximum of the object's bounding
+    // box by all hidden child-objects in its hierarchy.
+    AABB bbox(~op->GetMg());
+    LONG visited = 0;
+    std::unordered_set<BaseObject*> inactive;
+    ForEachInactiveLevel(op, [&](BaseObject* level) { inactive.insert(level); });
+    for (BaseObject* child = op->GetDown(); child; child = child->GetNext())
+    {
+      // Inactive levels of detail don't contribute.
+      if (inactive.count(child)) continue;
+      for (NodeIterator<BaseObject> it(child, child); it; ++it)
       {
-        m_protected = false;
-        HideNodes(op, doc, false);
+        ++visited;
+        // We skip objects that are being controlled by
+        // a generator object and suspended objects.
+        if (it->GetInfo() & OBJECT_GENERATOR && !IsControlledByGenerator(*it)
+            && !GetSuspendReasons(*it))
+          bbox.Expand(*it, it->GetMg(), false);
       }
     }
 
-    op->Message(MSG_CHANGE);
-    op->SetDirty(DIRTYFLAGS_DESCRIPTION);
-    EventAdd();
+    *mp = bbox.GetMidpoint();
+    *rad = bbox.GetSize();
+    SetBounds(*mp, *rad);
+    if (cacheFrame)
+      m_motion.Store(frame, *mp, *rad);
+
+    CounterAdd(m_counters, PERFCOUNTER_DIMENSION_CALLS, 1);
+    CounterAdd(m_counters, PERFCOUNTER_NODES_VISITED, visited);
+    CounterAdd(m_counters, PERFCOUNTER_DIMENSION_MICROS,
+      (Int64) ((GeGetMilliSeconds() - start) * 1000.0));
   }
 
-  /// Called to hide/unhide the container object contents.
-  void HideNodes(BaseObject* op, BaseDocument* doc, Bool hide)
+  virtual DRAWRESULT Draw(BaseObject* op, DRAWPASS drawpass, BaseDraw* bd,
+        BaseDrawHelp* bh) override
   {
-    if (hide)
+    if (drawpass != DRAWPASS_OBJECT || (!m_proxyActive && m_packed.IsEmpty()))
+      return super::Draw(op, drawpass, bd, bh);
+
+    // A packed container has no children to draw, show where they are.
+    if (!m_packed.IsEmpty())
     {
-      BaseContainer* bc = op->GetDataInstance();
-      CriticalAssert(bc != nullptr);
-      HideHierarchy(op->GetDown(), true, doc);
-      if (bc->GetBool(NRCONTAINER_HIDE_TAGS))
-        HideHierarchy(op->GetFirstTag(), true, doc);
-      if (bc->GetBool(NRCONTAINER_HIDE_MATERIALS))
-        HideMaterials(op, true, doc);
+      Vector mp, rad;
+      m_packed.GetBounds(&mp, &rad);
+      m_proxyLines.clear();
+      AddBoxLines(m_proxyLines, mp - rad, mp + rad);
     }
     else
-    {
-      HideHierarchy(op->GetDown(), false, doc);
-      HideHierarchy(op->GetFirstTag(), false, doc);
-      HideMaterials(op, false, doc);
-    }
+      UpdateProxy(op);
+    bd->SetPen(bd->GetObjectColor(bh, op));
+    bd->SetMatrix_Matrix(op, bh->GetMg());
+    for (size_t i = 0; i + 1 < m_proxyLines.size(); i += 2)
+      bd->DrawLine(m_proxyLines[i], m_proxyLines[i + 1], 0);
+    return DRAWRESULT_OK;
   }
 
-  // ObjectData Overrides
+  virtual Bool AddToExecution(BaseObject* op, PriorityList* list) override
+  {
+    BaseContainer* bc = op->GetDataInstance();
+    if (bc && (bc->GetBool(NRCONTAINER_LOD_ENABLE) || bc->GetBool(NRCONTAINER_SUSPEND)))
+      list->Add(op, EXECUTIONPRIORITY_EXPRESSION - 1, EXECUTIONFLAGS_0);
+    return true;
+  }
 
-  virtual void GetDimension(BaseObject* op, Vector* mp, Vector* rad) override
+  virtual EXECUTIONRESULT Execute(BaseObject* op, BaseDocument* doc,
+        BaseThread* bt, LONG priority, EXECUTIONFLAGS flags) override
   {
-    // Find the Minimum/Maximum of the object's bounding
-    // box by all hidden child-objects in its hierarchy.
-    AABB bbox;
-    for (NodeIterator<BaseObject> it(op->GetDown(), op); it; ++it)
+    // Suspending children inserted while suspended changes other
+    // objects and picking the level of detail needs the view, both are
+    // done on the main thread. Render documents keep the state they
+    // were cloned with.
+    BaseContainer* bc = op->GetDataInstance();
+    if (!bc || doc != GetActiveDocument()) return EXECUTIONRESULT_OK;
+    if (bc->GetBool(NRCONTAINER_SUSPEND))
     {
-      // We skip objects that are being controlled by
-      // a generator object.
-      if (it->GetInfo() & OBJECT_GENERATOR && !IsControlledByGenerator(*it))
-        bbox.Expand(*it, it->GetMg(), false);
+      if (HasResumedChildren(op))
+        SpecialEventAdd(CONTAINEROBJECT_MSG_SYNCCONTENTS);
     }
-
-    *mp = bbox.GetMidpoint();
-    *rad = bbox.GetSize();
+    else if (bc->GetBool(NRCONTAINER_LOD_ENABLE))
+      SpecialEventAdd(CONTAINEROBJECT_MSG_SYNCCONTENTS);
+    return EXECUTIONRESULT_OK;
   }
 
   //  NodeData Overrides
@@ -355,13 +1542,30 @@ public:
   {
     if (!node || !super::Init(node)) return false;
     if (m_customIcon) BaseBitmap::Free(m_customIcon);
+    UpdateIconBytes();
     m_protected = false;
     m_protectionHash = "";
+    m_proxyActive = false;
+    m_proxyLines.clear();
+    m_frozen.Flush();
+    m_freezeActive = false;
+    m_freezeStale = false;
+    m_frozenChecksum = 0;
+    m_packed.Flush();
+    m_motion.Flush();
+    m_lodLevel = -1;
     BaseContainer* bc = ((BaseList2D*) node)->GetDataInstance();
     if (!bc) return false;
+    bc->SetInt32(NRCONTAINER_PROXY_MODE, NRCONTAINER_PROXY_MODE_OFF);
+    bc->SetBool(NRCONTAINER_LOD_ENABLE, false);
+    bc->SetBool(NRCONTAINER_FREEZE_PERSIST, false);
+    bc->SetBool(NRCONTAINER_SUSPEND, false);
+    bc->SetBool(NRCONTAINER_RENDER_STRIP, false);
+    bc->SetBool(NRCONTAINER_MOTION_CACHE, false);
     bc->SetBool(NRCONTAINER_HIDE_TAGS, false);
     bc->SetBool(NRCONTAINER_HIDE_MATERIALS, true);
     bc->SetBool(NRCONTAINER_GENERATOR_CHECKMARK, true);
+    m_generatorCheckmark = true;
     bc->SetString(NRCONTAINER_INFO_NAME, ""_s);
     bc->SetString(NRCONTAINER_INFO_VERSION, ""_s);
     bc->SetString(NRCONTAINER_INFO_URL, ""_s);
@@ -373,15 +1577,27 @@ public:
 
   virtual void Free(GeListNode* node) override
   {
+    if (m_hideJob)
+    {
+      // The nodes are freed with the container, nothing to roll back.
+      g_hideJobs.erase(std::remove(g_hideJobs.begin(), g_hideJobs.end(), node), g_hideJobs.end());
+      gDelete(m_hideJob);
+    }
     super::Free(node);
     if (m_customIcon) BaseBitmap::Free(m_customIcon);
+    UpdateIconBytes();
   }
 
   virtual Bool Read(GeListNode* node, HyperFile* hf, LONG level) override
   {
+    TRACE_SCOPE("Read");
     Bool result = super::Read(node, hf, level);
     if (!result) return result;
 
+    BaseContainer* bc = static_cast<BaseList2D*>(node)->GetDataInstance();
+    if (bc)
+      m_generatorCheckmark = bc->GetBool(NRCONTAINER_GENERATOR_CHECKMARK, true);
+
     // VERSION 0
 
     // Read the custom icon from the HyperFile.
@@ -398,6 +1614,7 @@ public:
     }
     else if (m_customIcon)
       BaseBitmap::Free(m_customIcon);
+    UpdateIconBytes();
 
     // VERSION 1000
 
@@ -410,11 +1627,49 @@ public:
       }
     }
 
+    // VERSION 1011
+
+    m_proxyActive = false;
+    m_proxyLines.clear();
+    if (level >= 1011)
+    {
+      if (!hf->ReadBool(&m_proxyActive)) return false;
+    }
+
+    // VERSION 1012
+
+    m_frozen.Flush();
+    m_freezeActive = false;
+    m_freezeStale = false;
+    m_frozenChecksum = 0;
+    if (level >= 1012)
+    {
+      Bool hasMesh = false;
+      if (!hf->ReadBool(&m_freezeActive)) return false;
+      if (!hf->ReadBool(&hasMesh)) return false;
+      if (hasMesh && !m_frozen.Read(hf)) return false;
+      // Without a saved mesh the children must be evaluated again.
+      m_freezeStale = m_freezeActive && !hasMesh;
+    }
+
+    // VERSION 1013
+
+    m_motion.Flush();
+    m_packed.Flush();
+    if (level >= 1013)
+    {
+      Bool packed = false;
+      if (!hf->ReadBool(&packed)) return false;
+      if (packed && !m_packed.Read(hf)) return false;
+    }
+
+    ContainerRegistryUpdate(static_cast<BaseObject*>(node));
     return result;
   }
 
   virtual Bool Write(GeListNode* node, HyperFile* hf) override
   {
+    TRACE_SCOPE("Write");
     Bool result = super::Write(node, hf);
     if (!result) return result;
 
@@ -436,6 +1691,24 @@ public:
       if (!hf->WriteString(m_protectionHash)) return false;
     }
 
+    // VERSION 1011
+
+    if (!hf->WriteBool(m_proxyActive)) return false;
+
+    // VERSION 1012
+
+    BaseContainer* bc = static_cast<BaseList2D*>(node)->GetDataInstance();
+    const Bool persist = m_freezeActive && !m_freezeStale && bc
+      && bc->GetBool(NRCONTAINER_FREEZE_PERSIST);
+    if (!hf->WriteBool(m_freezeActive)) return false;
+    if (!hf->WriteBool(persist)) return false;
+    if (persist && !m_frozen.Write(hf)) return false;
+
+    // VERSION 1013
+
+    if (!hf->WriteBool(!m_packed.IsEmpty())) return false;
+    if (!m_packed.IsEmpty() && !m_packed.Write(hf)) return false;
+
     return result;
   }
 
@@ -456,6 +1729,40 @@ public:
       case MSG_EDIT:
         ToggleProtect(op);
         break;
+      case MSG_DOCUMENTINFO:
+      {
+        // Don't save a half protected container.
+        const DocumentInfoData* info = static_cast<DocumentInfoData*>(pData);
+        if (m_hideJob && info && (info->type == MSG_DOCUMENTINFO_TYPE_SAVE_BEFORE ||
+            info->type == MSG_DOCUMENTINFO_TYPE_SAVEPROJECT_BEFORE))
+        {
+          StepHideJob(op, std::numeric_limits<Float>::max());
+          EndHideJob(op, false);
+        }
+        break;
+      }
+      case MSG_MULTI_RENDERNOTIFICATION:
+        StripForRender(op, static_cast<RenderNotificationData*>(pData));
+        break;
+      case MSG_DESCRIPTION_POSTSETPARAMETER:
+      {
+        const DescID& id = *static_cast<DescriptionPostSetValue*>(pData)->descid;
+        BaseContainer* bc = op->GetDataInstance();
+        if (id[0].id == NRCONTAINER_PROXY_MODE)
+          UpdateProxyVisibility(op, op->GetDocument());
+        else if (id[0].id == NRCONTAINER_LOD_ENABLE && bc && !bc->GetBool(NRCONTAINER_LOD_ENABLE))
+          m_lodLevel = -1;
+        else if (id[0].id == NRCONTAINER_MOTION_CACHE)
+          m_motion.Flush();
+        else if (id[0].id == NRCONTAINER_SUSPEND && bc)
+        {
+          BaseDocument* doc = op->GetDocument();
+          const AutoUndo au(doc);
+          SuspendContents(op, bc->GetBool(NRCONTAINER_SUSPEND), doc);
+          op->SetDirty(DIRTYFLAGS_DATA);
+        }
+        break;
+      }
       default:
         break;
     }
@@ -465,20 +1772,40 @@ public:
   virtual Bool CopyTo(NodeData* nDest, GeListNode* node, GeListNode* destNode,
         COPYFLAGS flags, AliasTrans* at) override
   {
+    TRACE_SCOPE("CopyTo");
     Bool result = super::CopyTo(nDest, node, destNode, flags, at);
     if (!result) return result;
     ContainerObject* dest = (ContainerObject*) nDest;
 
+    // Copying into a container with a running job happens on undo. Roll
+    // the job back so the restored protection state matches the nodes.
+    if (dest->m_hideJob)
+      dest->EndHideJob(static_cast<BaseObject*>(destNode), true);
+
     // Copy the custom icon to the new NodeData.
     if (dest->m_customIcon)
       BaseBitmap::Free(dest->m_customIcon);
     if (m_customIcon)
       dest->m_customIcon = m_customIcon->GetClone();
+    dest->UpdateIconBytes();
 
     // And the other stuff.. :-)
     dest->m_protected = m_protected;
     dest->m_protectionHash = m_protectionHash;
-
+    dest->m_generatorCheckmark = m_generatorCheckmark;
+    dest->m_proxyActive = m_proxyActive;
+    dest->m_proxyLines.clear();
+    dest->m_lodLevel = m_lodLevel;
+    m_frozen.CopyTo(dest->m_frozen, flags, at);
+    dest->m_freezeActive = m_freezeActive;
+    dest->m_freezeStale = m_freezeStale;
+    dest->m_frozenChecksum = 0;
+    m_packed.CopyTo(dest->m_packed);
+    dest->m_motion.Flush();
+
+    // Undo and redo copy the protection state back without changing the
+    // hierarchy of the document.
+    ContainerRegistryUpdate(static_cast<BaseObject*>(destNode));
     return result;
   }
 
@@ -503,9 +1830,17 @@ public:
   {
     switch (id[0].id) {
       case NRCONTAINER_DEV_INFO:
-        data.SetString(""_s);
+        data.SetString(FormatCounters(m_counters, m_iconBytes));
         flags |= DESCFLAGS_GET_PARAM_GET;
         return true;
+      case NRCONTAINER_INFO_FINGERPRINT:
+      {
+        Fingerprint fp;
+        m_fingerprint.Compute(static_cast<BaseObject*>(node), &fp);
+        data.SetString(fp.ToString());
+        flags |= DESCFLAGS_GET_PARAM_GET;
+        return true;
+      }
     }
     return super::GetDParameter(node, id, data, flags);
   }
@@ -526,6 +1861,13 @@ public:
           return true;
         }
         break;
+      case NRCONTAINER_INFO_FINGERPRINT:
+        // Computed, never stored.
+        flags |= DESCFLAGS_SET_PARAM_SET;
+        return true;
+      case NRCONTAINER_GENERATOR_CHECKMARK:
+        m_generatorCheckmark = data.GetBool();
+        break;
     }
     return super::SetDParameter(node, id, data, flags);
   }
@@ -534,6 +1876,7 @@ public:
         const GeData& t_data, DESCFLAGS_ENABLE flags,
         const BaseContainer* itemdesc) override
   {
+    if (m_hideJob) return false;
     switch (id[0].id) {
       case NRCONTAINER_INFO_NAME:
       case NRCONTAINER_INFO_VERSION:
@@ -542,6 +1885,23 @@ public:
       case NRCONTAINER_INFO_AUTHOR_EMAIL:
       case NRCONTAINER_INFO_DESCRIPTION:
         return !this->m_protected;
+      case NRCONTAINER_INFO_FINGERPRINT:
+        return false;
+      case NRCONTAINER_PROXY_OBJECT:
+      {
+        BaseContainer* bc = static_cast<BaseList2D*>(node)->GetDataInstance();
+        return bc && bc->GetInt32(NRCONTAINER_PROXY_MODE) == NRCONTAINER_PROXY_MODE_OBJECT;
+      }
+      case NRCONTAINER_FREEZE:
+      case NRCONTAINER_PACKUP:
+        return m_packed.IsEmpty();
+      case NRCONTAINER_PACK:
+        return m_packed.IsEmpty() && !m_freezeActive
+          && static_cast<BaseObject*>(node)->GetDown() != nullptr;
+      case NRCONTAINER_UNPACK:
+        return !m_packed.IsEmpty();
+      case NRCONTAINER_MOTION_BAKE:
+        return UseMotionCache(static_cast<BaseObject*>(node));
     }
     return super::GetDEnabling(node, id, t_data, flags, itemdesc);
   }
@@ -576,31 +1936,414 @@ Bool ContainerProtect(BaseObject* op, String const& pass, String hash, Bool pack
 {
   if (!op || op->GetType() != Ocontainer) return false;
   ContainerObject* data = GetNodeData<ContainerObject>(op);
-  if (!data) return false;
+  if (!data || data->m_hideJob) return false;
   if (data->m_protected)
     return false;
   if (IsEmpty(hash))
     hash = HashString(pass);
   data->m_protected = true;
   data->m_protectionHash = hash;
+  ContainerRegistryUpdate(op);
   if (packup)
     data->HideNodes(op, nullptr, packup);
   return true;
 }
 
+/// ***************************************************************************
+/// ***************************************************************************
+Bool ContainerUnprotect(BaseObject* op, String const& pass)
+{
+  if (!op || op->GetType() != Ocontainer) return false;
+  ContainerObject* data = GetNodeData<ContainerObject>(op);
+  if (!data || data->m_hideJob) return false;
+  if (!data->m_protected)
+    return false;
+  if (data->m_protectionHash != HashString(pass))
+    return false;
+  data->m_protected = false;
+  ContainerRegistryUpdate(op);
+  data->HideNodes(op, nullptr, false);
+  return true;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+Bool ContainerHideContents(BaseObject* op, BaseDocument* doc)
+{
+  if (!op || op->GetType() != Ocontainer) return false;
+  ContainerObject* data = GetNodeData<ContainerObject>(op);
+  if (!data || data->m_hideJob || !data->m_protected) return false;
+  data->HideNodes(op, doc, true);
+  return true;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+Bool ContainerSetIcon(BaseObject* op, BaseBitmap const* bmp)
+{
+  if (!op || op->GetType() != Ocontainer) return false;
+  ContainerObject* data = GetNodeData<ContainerObject>(op);
+  if (!data) return false;
+  if (data->m_customIcon)
+    BaseBitmap::Free(data->m_customIcon);
+  data->UpdateIconBytes();
+  if (!bmp)
+    return true;
+
+  // Scale the bitmap down to 64x64 pixels.
+  BaseBitmap* dest = BaseBitmap::Alloc();
+  if (!dest) return false;
+  const LONG size = CONTAINEROBJECT_ICONSIZE;
+  dest->Init(size, size);
+  const_cast<BaseBitmap*>(bmp)->ScaleIt(dest, 256, true, true);
+  data->m_customIcon = dest;
+  data->UpdateIconBytes();
+  return true;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+Bool ContainerFreeze(BaseObject* op, Bool freeze, BaseDocument* doc)
+{
+  if (!op || op->GetType() != Ocontainer) return false;
+  ContainerObject* data = GetNodeData<ContainerObject>(op);
+  if (!data) return false;
+  if (!freeze)
+  {
+    if (!data->m_freezeActive) return false;
+    data->Unfreeze(op, nullptr);
+    return true;
+  }
+  return data->Freeze(op, doc ? doc : op->GetDocument(), nullptr);
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+Bool ContainerPack(BaseObject* op, Bool pack, BaseDocument* doc, Bool undo)
+{
+  if (!op || op->GetType() != Ocontainer) return false;
+  ContainerObject* data = GetNodeData<ContainerObject>(op);
+  if (!data) return false;
+  if (!doc) doc = op->GetDocument();
+  return pack ? data->Pack(op, doc, undo) : data->Unpack(op, doc, undo);
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+Bool ContainerIsPacked(BaseObject* op)
+{
+  if (!op || op->GetType() != Ocontainer) return false;
+  ContainerObject* data = GetNodeData<ContainerObject>(op);
+  return data && !data->m_packed.IsEmpty();
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+Int64 ContainerGetDataSize(BaseObject* op)
+{
+  if (!op || op->GetType() != Ocontainer) return 0;
+  ContainerObject* data = GetNodeData<ContainerObject>(op);
+  if (!data) return 0;
+  return data->m_iconBytes + data->m_packed.GetMemorySize() + data->m_motion.GetMemorySize();
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+UInt32 ContainerGetSpatialStamp(BaseObject* op)
+{
+  if (!op || op->GetType() != Ocontainer) return 0;
+  ContainerObject* data = GetNodeData<ContainerObject>(op);
+  if (!data) return 0;
+
+  // The world matrix changes with the local matrix of any ancestor.
+  UInt32 stamp = data->m_boundsStamp;
+  for (BaseObject* node = op; node; node = node->GetUp())
+    stamp = stamp * 31 + node->GetDirty(DIRTYFLAGS_MATRIX);
+  return stamp;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+Bool ContainerGetWorldBounds(BaseObject* op, Vector* bbmin, Vector* bbmax)
+{
+  if (!op || op->GetType() != Ocontainer) return false;
+  ContainerObject* data = GetNodeData<ContainerObject>(op);
+  if (!data) return false;
+
+  // The extent of the transformed box along each world axis.
+  const Matrix mg = op->GetMg();
+  const Vector& rad = data->m_bboxRad;
+  const Vector center = mg * data->m_bboxMp;
+  const Vector extent(
+    Abs(mg.sqmat.v1.x) * rad.x + Abs(mg.sqmat.v2.x) * rad.y + Abs(mg.sqmat.v3.x) * rad.z,
+    Abs(mg.sqmat.v1.y) * rad.x + Abs(mg.sqmat.v2.y) * rad.y + Abs(mg.sqmat.v3.y) * rad.z,
+    Abs(mg.sqmat.v1.z) * rad.x + Abs(mg.sqmat.v2.z) * rad.y + Abs(mg.sqmat.v3.z) * rad.z);
+  *bbmin = center - extent;
+  *bbmax = center + extent;
+  return true;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+Bool ContainerGetViewFrustum(BaseDraw* bd, ContainerFrustum* out)
+{
+  if (!bd || !out) return false;
+  Int32 cl, ct, cr, cb;
+  bd->GetFrame(&cl, &ct, &cr, &cb);
+
+  // Corners of the view on a near and a far depth, in world space.
+  const Float x[4] = {(Float) cl, (Float) cr, (Float) cr, (Float) cl};
+  const Float y[4] = {(Float) ct, (Float) ct, (Float) cb, (Float) cb};
+  Vector n[4], f[4], center(0.0);
+  for (LONG i = 0; i < 4; ++i)
+  {
+    n[i] = bd->SW(Vector(x[i], y[i], 1.0));
+    f[i] = bd->SW(Vector(x[i], y[i], 1000.0));
+    center += (n[i] + f[i]) * 0.125;
+  }
+
+  out->count = 0;
+  auto addPlane = [&](const Vector& a, const Vector& b, const Vector& c) {
+    Vector normal = Cross(b - a, c - a).GetNormalized();
+    Float offset = -Dot(normal, a);
+    if (Dot(normal, center) + offset < 0.0)
+    {
+      normal = -normal;
+      offset = -offset;
+    }
+    out->normals[out->count] = normal;
+    out->offsets[out->count] = offset;
+    ++out->count;
+  };
+  for (LONG i = 0; i < 4; ++i)
+    addPlane(n[i], n[(i + 1) % 4], f[i]);
+  addPlane(n[0], n[1], n[2]);
+  return true;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+Bool ContainerGetMotionBounds(BaseObject* op, const BaseTime& from, const BaseTime& to,
+  Vector* mp, Vector* rad)
+{
+  if (!op || !mp || !rad || op->GetType() != Ocontainer) return false;
+  ContainerObject* data = GetNodeData<ContainerObject>(op);
+  BaseDocument* doc = op->GetDocument();
+  if (!data || !doc) return false;
+
+  // Without samples (cache disabled, frozen or packed) the current
+  // bounds are the best we have.
+  const LONG fps = doc->GetFps();
+  data->m_motion.Validate(op, doc->GetTime().GetFrame(fps), fps);
+  if (!data->m_motion.GetCount())
+  {
+    *mp = op->GetMp();
+    *rad = op->GetRad();
+    return false;
+  }
+  const LONG first = (LONG) std::floor(from.Get() * fps);
+  const LONG last = (LONG) std::ceil(to.Get() * fps);
+  return data->m_motion.GetUnion(first, last, mp, rad);
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+Bool ContainerIsFrozen(BaseObject* op, Bool* stale)
+{
+  if (!op || op->GetType() != Ocontainer) return false;
+  ContainerObject* data = GetNodeData<ContainerObject>(op);
+  if (!data || !data->m_freezeActive) return false;
+  if (stale)
+    *stale = data->m_freezeStale;
+  return true;
+}
+
+/// ***************************************************************************
+/// Rebuilds the meshes of frozen containers whose children changed. The
+/// containers ask for this with #CONTAINEROBJECT_MSG_REFREEZE because
+/// the document may not be executed from GetVirtualObjects().
+/// ***************************************************************************
+class RefreezeMessage : public MessageData
+{
+public:
+
+  virtual Bool CoreMessage(LONG id, const BaseContainer& bc) override
+  {
+    if (id != CONTAINEROBJECT_MSG_REFREEZE) return true;
+    // Wait for playback to stop, the request is repeated on every frame.
+    if (CheckIsRunning(CHECKISRUNNING_ANIMATIONRUNNING)) return true;
+    BaseDocument* doc = GetActiveDocument();
+    if (!doc) return true;
+
+    Bool changed = false;
+    std::vector<ContainerInfo> containers;
+    ContainerFindAll(doc, &containers);
+    for (const ContainerInfo& info : containers)
+    {
+      Bool stale = false;
+      if (!ContainerIsFrozen(info.op, &stale) || !stale) continue;
+      BaseContainer* data = info.op->GetDataInstance();
+      if (data && data->GetBool(NRCONTAINER_SUSPEND)) continue;
+      changed |= ContainerFreeze(info.op, true, doc);
+    }
+    if (changed)
+      EventAdd();
+    return true;
+  }
+};
+
+/// ***************************************************************************
+/// Suspends the children that were added to suspended containers and
+/// switches the levels of detail of the active document. Containers ask
+/// for this with #CONTAINEROBJECT_MSG_SYNCCONTENTS from Execute(), where
+/// other objects may not be changed. The camera is that of the render
+/// view of the document.
+/// ***************************************************************************
+class ContentSyncMessage : public MessageData
+{
+public:
+
+  virtual Bool CoreMessage(LONG id, const BaseContainer& bc) override
+  {
+    if (id != CONTAINEROBJECT_MSG_SYNCCONTENTS) return true;
+    BaseDocument* doc = GetActiveDocument();
+    if (!doc) return true;
+    TRACE_SCOPE("ContentSync");
+
+    BaseDraw* bd = doc->GetRenderBaseDraw();
+    Bool changed = false;
+    std::vector<ContainerInfo> containers;
+    ContainerFindAll(doc, &containers);
+    for (const ContainerInfo& info : containers)
+    {
+      if (info.isNull) continue;
+      ContainerObject* data = GetNodeData<ContainerObject>(info.op);
+      BaseContainer* opbc = info.op->GetDataInstance();
+      if (!data || !opbc || data->m_hideJob) continue;
+      if (opbc->GetBool(NRCONTAINER_SUSPEND))
+      {
+        if (!ContainerObject::HasResumedChildren(info.op)) continue;
+        data->SuspendContents(info.op, true, nullptr);
+        changed = true;
+      }
+      else if (opbc->GetBool(NRCONTAINER_LOD_ENABLE))
+        changed |= data->UpdateLod(info.op, doc, bd);
+    }
+    if (changed)
+      EventAdd();
+    return true;
+  }
+};
+
+/// ***************************************************************************
+/// Runs the slices of all #HideJob%s. Each slice is followed by a new
+/// core message so the UI gets to process its events in between. Esc
+/// cancels all running jobs.
+/// ***************************************************************************
+class HideJobMessage : public MessageData
+{
+public:
+
+  virtual Bool CoreMessage(LONG id, const BaseContainer& bc) override
+  {
+    if (id != CONTAINEROBJECT_MSG_HIDESLICE || g_hideJobs.empty()) return true;
+
+    BaseContainer state;
+    const Bool cancel = GetInputState(BFM_INPUT_KEYBOARD, KEY_ESC, state)
+        && state.GetInt32(BFM_INPUT_VALUE);
+
+    const Float deadline = GeGetMilliSeconds() + HIDEJOB_SLICE_MS;
+    Int64 done = 0, total = 0;
+    Bool hide = false;
+    const std::vector<BaseObject*> jobs = g_hideJobs;
+    for (BaseObject* op : jobs)
+    {
+      ContainerObject* data = GetNodeData<ContainerObject>(op);
+      if (!data || !data->m_hideJob) continue;
+      if (cancel || data->StepHideJob(op, deadline))
+      {
+        data->EndHideJob(op, cancel);
+        continue;
+      }
+      done += data->m_hideJob->next;
+      total += data->m_hideJob->nodes.size();
+      hide = data->m_hideJob->hide;
+    }
+
+    if (g_hideJobs.empty())
+      StatusClear();
+    else
+    {
+      StatusSetText(GeLoadString(hide ? IDS_STATUS_PROTECTING : IDS_STATUS_UNPROTECTING,
+        String::IntToString(done), String::IntToString(total)));
+      StatusSetBar(total > 0 ? (LONG) (done * 100 / total) : 0);
+      SpecialEventAdd(CONTAINEROBJECT_MSG_HIDESLICE);
+    }
+    EventAdd();
+    return true;
+  }
+};
+
+/// ***************************************************************************
+/// ***************************************************************************
+Bool ContainerIsBusy(BaseObject* op)
+{
+  if (!op || op->GetType() != Ocontainer) return false;
+  ContainerObject* data = GetNodeData<ContainerObject>(op);
+  return data && data->m_hideJob;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+BaseBitmap const* ContainerGetIcon(BaseObject* op)
+{
+  if (!op || op->GetType() != Ocontainer) return nullptr;
+  ContainerObject* data = GetNodeData<ContainerObject>(op);
+  return data ? data->m_customIcon : nullptr;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+Bool ContainerGetFingerprint(BaseObject* op, Fingerprint* out)
+{
+  if (!op || !out || op->GetType() != Ocontainer) return false;
+  ContainerObject* data = GetNodeData<ContainerObject>(op);
+  if (!data) return false;
+  data->m_fingerprint.Compute(op, out);
+  return true;
+}
+
+#ifdef NRCONTAINER_BENCHMARK
+/// ***************************************************************************
+/// ***************************************************************************
+void ContainerHideMaterials(BaseObject* op, Bool hide, BaseDocument* doc)
+{
+  std::unordered_set<BaseObject*> snapshot;
+  HidePlanContext ctx = MakeHidePlanContext(op, true, snapshot);
+  HidePlanPart part;
+  for (NodeIterator<BaseObject> it(op, op); it; ++it)
+    PlanTextureTags(*it, part);
+  ResolveMaterials(ctx, part);
+  ApplyHideNodes(part.nodes, hide, doc);
+}
+#endif
+
 /// ***************************************************************************
 /// Hook to modify the container object info bitmask based on the parameters.
+/// This is called for every object in the application, keep it cheap.
 /// ***************************************************************************
 decltype(C4D_Object::GetInfo) _orig_GetInfo = nullptr;
-static LONG _hook_GetInfo(GeListNode* op)
+LONG _hook_GetInfo(GeListNode* op)
 {
+  #ifdef NRCONTAINER_BENCHMARK
+    GlobalCounterAdd(PERFCOUNTER_GETINFO_CALLS, 1);
+  #endif
   if (op && op->GetType() == Ocontainer) {
-    GeData data;
-    op->GetParameter(NRCONTAINER_GENERATOR_CHECKMARK, data, DESCFLAGS_GET_0);
-    if (data.GetBool())
-      return OBJECT_GENERATOR;
+    ContainerObject* data = GetNodeData<ContainerObject>(op);
+    if (data && data->m_generatorCheckmark)
+      return OBJECT_GENERATOR | OBJECT_CALL_ADDEXECUTION;
     else
-      return 0;
+      return OBJECT_CALL_ADDEXECUTION;
   }
   return _orig_GetInfo(op);
 }
@@ -612,7 +2355,7 @@ Bool RegisterContainerObject(Bool menu)
 {
   if (menu) {
     BaseContainer* menu = nullptr;
-    FindMenuResource("M_EDITOR", "IDS_MENU_OBJECT", &menu);
+    FindMenuResourceCached("M_EDITOR", "IDS_MENU_OBJECT", CONTAINEROBJECT_MENUCACHE_PREFS, &menu);
     if (menu) {
       menu->InsData(MENURESOURCE_SEPERATOR, true);
       menu->InsData(MENURESOURCE_COMMAND, "PLUGIN_CMD_" + LongToString(Ocontainer));
@@ -623,13 +2366,20 @@ Bool RegisterContainerObject(Bool menu)
   _orig_GetInfo = C4DOS.Bo->GetInfo;
   C4DOS.Bo->GetInfo = _hook_GetInfo;
 
+  RegisterMessagePlugin(CONTAINEROBJECT_REFREEZE_PLUGIN, "Container Refreeze"_s,
+    0, gNew(RefreezeMessage));
+  RegisterMessagePlugin(CONTAINEROBJECT_HIDEJOB_PLUGIN, "Container Protect"_s,
+    0, gNew(HideJobMessage));
+  RegisterMessagePlugin(CONTAINEROBJECT_SYNCCONTENTS_PLUGIN, "Container Sync"_s,
+    0, gNew(ContentSyncMessage));
+
   AutoAlloc<BaseBitmap> bmp;
-  bmp->Init(GeGetPluginPath() + "res" + "img" + "ocontainer.png");
+  InitEmbeddedIcon(bmp, EmbeddedIcons::ocontainer);
 
   return RegisterObjectPlugin(
     Ocontainer,
     GeLoadString(IDS_OCONTAINER),
-    OBJECT_GENERATOR,
+    OBJECT_GENERATOR | OBJECT_CALL_ADDEXECUTION,
     ContainerObject::Alloc,
     "Ocontainer"_s,
     bmp,
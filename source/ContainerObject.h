@@ -11,15 +11,251 @@
 #ifndef _CONTAINEROBJECT_H
 #define _CONTAINEROBJECT_H
 
+#include <vector>
+#include "Utils/Fingerprint.h"
+
 enum
 {
-  CONTAINEROBJECT_DISKLEVEL = 1010,
+  CONTAINEROBJECT_DISKLEVEL = 1013,
   CONTAINEROBJECT_ICONSIZE = 64,
   CONTAINEROBJECT_PROTECTIONHASH = 1036106,
+
+  /// Plugin message that writes the recorded trace events to disk,
+  /// eg. `c4d.GePluginMessage(1039503, 0)` from Python.
+  CONTAINEROBJECT_MSG_FLUSHTRACE = 1039503,
+
+  /// Core message sent by frozen containers whose inputs changed. The
+  /// frozen mesh is rebuilt on the main thread.
+  CONTAINEROBJECT_MSG_REFREEZE = 1039507,
+  CONTAINEROBJECT_REFREEZE_PLUGIN = 1039506,
+
+  /// World plugin container that caches the location of the Object menu.
+  CONTAINEROBJECT_MENUCACHE_PREFS = 1039514,
+
+  /// Core message that runs the next slice of an interactive protect or
+  /// unprotect of a large container.
+  CONTAINEROBJECT_MSG_HIDESLICE = 1039516,
+  CONTAINEROBJECT_HIDEJOB_PLUGIN = 1039515,
+
+  /// Core message sent from the execution of suspended containers and
+  /// containers with levels of detail. The children are suspended or
+  /// switched on the main thread.
+  CONTAINEROBJECT_MSG_SYNCCONTENTS = 1039523,
+  CONTAINEROBJECT_SYNCCONTENTS_PLUGIN = 1039522,
+
+  /// Scene hook that drops the container registry of a freed document.
+  CONTAINEROBJECT_REGISTRY_HOOK = 1039521,
 };
 
+/// ***************************************************************************
+/// A Container or protected Null object (one with a
+/// #CONTAINEROBJECT_PROTECTIONHASH) as known to the container registry.
+/// ***************************************************************************
+struct ContainerInfo
+{
+  BaseObject* op;
+  BaseObject* parent;  ///< The closest registered ancestor or \c nullptr.
+  Bool isNull;         ///< True for protected Null objects.
+  Bool isProtected;
+};
+
+/// ***************************************************************************
+/// Looks up *op* in the registry of its document. Returns false if *op*
+/// is neither a Container nor a protected Null object. Objects that are
+/// not in a document are inspected directly. The registry is rebuilt
+/// only after the object hierarchy of the document changed.
+/// ***************************************************************************
+Bool ContainerLookup(BaseObject* op, ContainerInfo* info=nullptr);
+
+/// ***************************************************************************
+/// Fills *out* with all Containers and protected Null objects in *doc* in
+/// hierarchy order and returns their number.
+/// ***************************************************************************
+LONG ContainerFindAll(BaseDocument* doc, std::vector<ContainerInfo>* out);
+
+/// ***************************************************************************
+/// Must be called after the protection state of *op* changed.
+/// ***************************************************************************
+void ContainerRegistryUpdate(BaseObject* op);
+
+/// ***************************************************************************
+/// A convex volume bounded by the planes `Dot(normals[i], p) + offsets[i]
+/// >= 0`, eg. the view frustum of a viewport.
+/// ***************************************************************************
+struct ContainerFrustum
+{
+  Vector normals[6];
+  Float offsets[6];
+  LONG count;
+};
+
+/// ***************************************************************************
+/// A Container hit by ContainerQueryRay() and the distance along the ray
+/// at which it enters the Container's bounding box.
+/// ***************************************************************************
+struct ContainerRayHit
+{
+  BaseObject* op;
+  Float distance;
+};
+
+/// ***************************************************************************
+/// Returns the world space bounding box of the Container *op*, as last
+/// computed by its GetDimension().
+/// ***************************************************************************
+Bool ContainerGetWorldBounds(BaseObject* op, Vector* bbmin, Vector* bbmax);
+
+/// ***************************************************************************
+/// Returns a number that changes whenever the result of
+/// ContainerGetWorldBounds() for *op* may have changed, ie. after its
+/// bounds or the matrix of *op* or one of its parents changed.
+/// ***************************************************************************
+UInt32 ContainerGetSpatialStamp(BaseObject* op);
+
+/// ***************************************************************************
+/// Spatial queries over the world bounding boxes of the Containers in
+/// *doc*. The matching Containers are appended to *out* (which may be
+/// \c nullptr) and their number is returned. Ray hits are sorted by
+/// distance, *dir* doesn't need to be normalized (the distance is in
+/// multiples of its length).
+/// ***************************************************************************
+LONG ContainerQueryBox(BaseDocument* doc, const Vector& bbmin, const Vector& bbmax,
+  std::vector<BaseObject*>* out);
+LONG ContainerQueryFrustum(BaseDocument* doc, const ContainerFrustum& frustum,
+  std::vector<BaseObject*>* out);
+LONG ContainerQueryRay(BaseDocument* doc, const Vector& origin, const Vector& dir,
+  Float maxDist, std::vector<ContainerRayHit>* out);
+
+/// ***************************************************************************
+/// Computes the view frustum of *bd* for ContainerQueryFrustum(). The
+/// frustum has no far plane.
+/// ***************************************************************************
+Bool ContainerGetViewFrustum(BaseDraw* bd, ContainerFrustum* out);
+
+/// ***************************************************************************
+/// Fields filled by ContainerQueryBatch().
+/// ***************************************************************************
+enum CONTAINERBATCH
+{
+  CONTAINERBATCH_BOUNDS = (1 << 0),
+  CONTAINERBATCH_PROTECTION = (1 << 1),
+  CONTAINERBATCH_FINGERPRINT = (1 << 2),
+  CONTAINERBATCH_COUNTS = (1 << 3),
+  CONTAINERBATCH_INFO = (1 << 4),
+  CONTAINERBATCH_ALL = 0x1f,
+
+  /// Number of info strings per Container, in the order NAME, VERSION,
+  /// URL, AUTHOR, AUTHOR_EMAIL, DESCRIPTION.
+  CONTAINERBATCH_INFOCOUNT = 6,
+};
+
+/// ***************************************************************************
+/// The properties of all Containers of a document as parallel arrays,
+/// entry *i* of every array belongs to `objects[i]`. Arrays of fields
+/// that were not requested are empty. Every array is contiguous with a
+/// fixed stride so it can be handed out as a buffer without copying.
+/// Reusing the same instance for further queries reuses its memory.
+/// ***************************************************************************
+struct ContainerBatch
+{
+  LONG count;
+  std::vector<BaseObject*> objects;
+  std::vector<Float> bounds;           ///< World min xyz, max xyz, 6 per Container.
+  std::vector<UChar> isProtected;      ///< 0 or 1.
+  std::vector<UChar> fingerprints;     ///< 32 bytes per Container.
+  std::vector<Int32> objectCounts;     ///< Objects below the Container.
+  std::vector<Int32> tagCounts;        ///< Tags of these objects.
+  std::vector<Int64> pointCounts;      ///< Points of these objects.
+  std::vector<Char> strings;           ///< UTF-8 info strings, each null-terminated.
+  std::vector<Int32> stringOffsets;    ///< Into #strings, #CONTAINERBATCH_INFOCOUNT per Container.
+
+  ContainerBatch() : count(0) { }
+};
+
+/// ***************************************************************************
+/// Fills *out* with the *fields* (#CONTAINERBATCH flags) of every
+/// Container in *doc* in hierarchy order and returns their number. The
+/// counts include nested Containers and are gathered in parallel.
+/// ***************************************************************************
+LONG ContainerQueryBatch(BaseDocument* doc, ContainerBatch* out, LONG fields=CONTAINERBATCH_ALL);
+
+/// ***************************************************************************
+/// Computes the content hash of the hierarchy below the Container *op*.
+/// Only nodes that changed since the last call are hashed again.
+/// ***************************************************************************
+Bool ContainerGetFingerprint(BaseObject* op, Fingerprint* out);
+
+/// ***************************************************************************
+/// Turns every Container in *doc* whose contents equal those of an earlier
+/// Container into an instance of that one. Candidates are grouped by
+/// fingerprint and protection and compared node by node. Containers
+/// whose contents are linked from outside are skipped. The duplicates
+/// keep their matrix and settings but lose their children. Returns the number of
+/// converted Containers, the number of removed objects and points and
+/// an estimate of the bytes they took in the saved scene.
+/// ***************************************************************************
+LONG ContainerInstanceDuplicates(BaseDocument* doc, LONG* objects=nullptr, Int64* points=nullptr,
+  Int64* bytes=nullptr);
+
+/// ***************************************************************************
+/// Replaces the instance link of *op* with a copy of the master's
+/// children. Undos are added to *doc*.
+/// ***************************************************************************
+Bool ContainerMakeUnique(BaseObject* op, BaseDocument* doc);
+
+/// ***************************************************************************
+/// Hides the contents of the protected Container *op* again, eg. after
+/// children were added to it. Undos are added to *doc* if it is not
+/// \c nullptr. Returns false if *op* is not protected.
+/// ***************************************************************************
+Bool ContainerHideContents(BaseObject* op, BaseDocument* doc);
+
 Bool ContainerIsProtected(BaseObject* op, String* hash=nullptr);
 Bool ContainerProtect(BaseObject* op, String const& pass, String hash, Bool packup=true);
+Bool ContainerUnprotect(BaseObject* op, String const& pass);
+Bool ContainerSetIcon(BaseObject* op, BaseBitmap const* bmp);
+BaseBitmap const* ContainerGetIcon(BaseObject* op);
+Bool ContainerFreeze(BaseObject* op, Bool freeze, BaseDocument* doc);
+Bool ContainerIsFrozen(BaseObject* op, Bool* stale=nullptr);
+
+/// ***************************************************************************
+/// Packs the children of *op* with their tags and materials into a
+/// compressed blob inside of the container and removes the children from
+/// *doc*, or inserts them again. Materials are not removed when packing,
+/// unpacking reuses materials of the same name. With *undo*, undos are
+/// added to *doc* and the caller must have called StartUndo().
+/// ***************************************************************************
+Bool ContainerPack(BaseObject* op, Bool pack, BaseDocument* doc, Bool undo=false);
+Bool ContainerIsPacked(BaseObject* op);
+
+/// ***************************************************************************
+/// Computes the union of the bounding boxes of *op* (in object space)
+/// over the frames from *from* to *to*, eg. a shutter interval. Only the
+/// frames cached by "Cache Motion Bounds" are used. Returns false if
+/// not every frame of the interval is cached.
+/// ***************************************************************************
+Bool ContainerGetMotionBounds(BaseObject* op, const BaseTime& from, const BaseTime& to,
+  Vector* mp, Vector* rad);
+
+/// ***************************************************************************
+/// Returns the bytes held by the Container *op* itself: the custom icon,
+/// the packed contents and the motion bounds cache. The frozen mesh is
+/// served as the cache of *op* and is not included.
+/// ***************************************************************************
+Int64 ContainerGetDataSize(BaseObject* op);
+
+/// ***************************************************************************
+/// Returns true while an interactive protect or unprotect of *op* is
+/// still in progress. The container must not be modified until then.
+/// ***************************************************************************
+Bool ContainerIsBusy(BaseObject* op);
+BaseObject* ContainerFromNull(BaseObject* op, BaseDocument* doc);
+BaseObject* ContainerToNull(BaseObject* op, BaseDocument* doc);
 Bool RegisterContainerObject(Bool menu);
 
+#ifdef NRCONTAINER_BENCHMARK
+void ContainerHideMaterials(BaseObject* op, Bool hide, BaseDocument* doc);
+extern decltype(C4D_Object::GetInfo) _orig_GetInfo;
+#endif
+
 #endif // _CONTAINEROBJECT_H
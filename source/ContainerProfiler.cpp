@@ -0,0 +1,379 @@
+/// Copyright (C) 2013-2015, Niklas Rosenstein
+/// All rights reserved.
+///
+/// Licensed under the GNU Lesser General Public License.
+///
+/// \file ContainerProfiler.cpp
+///
+/// The "Profile Containers" command attributes the evaluation time of
+/// the active document to its Containers. Cinema 4D does not report
+/// the time spent in individual nodes, so the cost is measured by
+/// difference: a clone of the document is evaluated over a range of
+/// frames once as it is, and once with each Container suspended. The
+/// most expensive Containers are then broken down the same way by
+/// suspending their generators, deformers and expression tags one at a
+/// time. Costs are kept per frame and reported as average and peak.
+
+#include <c4d.h>
+#include <c4d_apibridge.h>
+#include <Ocontainer.h>
+#include "res/c4d_symbols.h"
+#include "ContainerObject.h"
+#include "Utils/Misc.h"
+#include "Utils/Suspend.h"
+#include "Utils/Trace.h"
+
+#include <algorithm>
+#include <vector>
+
+enum
+{
+  ID_COMMAND_PROFILECONTAINERS = 1039517,
+};
+
+/// Number of frames evaluated per measurement, starting at the current
+/// time of the document.
+static const LONG PROFILE_FRAMES = 10;
+
+/// Each frame is evaluated this many times, the fastest run counts.
+static const LONG PROFILE_REPEAT = 3;
+
+/// Number of Containers that are broken down into their nodes.
+static const LONG PROFILE_TOPCONTAINERS = 5;
+
+/// Maximum number of nodes measured per Container.
+static const LONG PROFILE_MAXCANDIDATES = 24;
+
+/// Number of nodes listed per Container in the report.
+static const LONG PROFILE_TOPNODES = 5;
+
+/// ***************************************************************************
+/// The time attributed to a Container or a node inside of it.
+/// ***************************************************************************
+struct ProfileCost
+{
+  Float avgMs;
+  Float peakMs;
+};
+
+/// ***************************************************************************
+/// ***************************************************************************
+struct ProfileNode
+{
+  String name;
+  String kind;
+  ProfileCost cost;
+};
+
+/// ***************************************************************************
+/// ***************************************************************************
+struct ProfileContainer
+{
+  BaseObject* op;       ///< In the cloned document.
+  BaseObject* parent;   ///< Enclosing Container in the cloned document.
+  String path;
+  ProfileCost cost;
+  Float selfMs;         ///< Average without the nested Containers.
+  LONG skipped;         ///< Nodes that were not measured.
+  std::vector<ProfileNode> nodes;
+};
+
+/// ***************************************************************************
+/// Evaluates a document over a range of frames and records the time of
+/// every frame.
+/// ***************************************************************************
+class Profiler
+{
+public:
+
+  Profiler(BaseDocument* doc, BaseTime start, LONG frames)
+  : m_doc(doc), m_start(start), m_frames(frames) { }
+
+  /// Records the time of each frame in *times*. Returns false if the
+  /// user pressed Esc.
+  Bool Play(std::vector<Float>& times)
+  {
+    TRACE_SCOPE("Profiler::Play");
+    const LONG fps = m_doc->GetFps();
+    const LONG first = m_start.GetFrame(fps);
+    times.assign(m_frames, 0.0);
+    for (LONG rep = 0; rep < PROFILE_REPEAT; ++rep)
+    {
+      for (LONG i = 0; i < m_frames; ++i)
+      {
+        m_doc->SetTime(BaseTime(first + i, fps));
+        const Float start = GeGetMilliSeconds();
+        m_doc->ExecutePasses(nullptr, true, true, true, BUILDFLAGS_0);
+        const Float delta = GeGetMilliSeconds() - start;
+        if (rep == 0 || delta < times[i])
+          times[i] = delta;
+      }
+      BaseContainer state;
+      if (GetInputState(BFM_INPUT_KEYBOARD, KEY_ESC, state) && state.GetInt32(BFM_INPUT_VALUE))
+        return false;
+    }
+    return true;
+  }
+
+  /// Plays the document with *node* suspended and returns the time
+  /// that was saved against *baseline*.
+  Bool Measure(BaseList2D* node, Bool hierarchy, const std::vector<Float>& baseline, ProfileCost* cost)
+  {
+    if (hierarchy)
+      SuspendHierarchy(static_cast<BaseObject*>(node), SUSPENDREASON_USER, true, nullptr);
+    else
+      SuspendNode(node, SUSPENDREASON_USER, true, nullptr);
+
+    std::vector<Float> times;
+    const Bool ok = Play(times);
+
+    if (hierarchy)
+      SuspendHierarchy(static_cast<BaseObject*>(node), SUSPENDREASON_USER, false, nullptr);
+    else
+      SuspendNode(node, SUSPENDREASON_USER, false, nullptr);
+    if (!ok) return false;
+
+    cost->avgMs = 0.0;
+    cost->peakMs = 0.0;
+    for (LONG i = 0; i < m_frames; ++i)
+    {
+      const Float delta = std::max<Float>(0.0, baseline[i] - times[i]);
+      cost->avgMs += delta;
+      cost->peakMs = std::max(cost->peakMs, delta);
+    }
+    cost->avgMs /= m_frames;
+    return true;
+  }
+
+private:
+
+  BaseDocument* m_doc;
+  BaseTime m_start;
+  LONG m_frames;
+};
+
+/// ***************************************************************************
+/// Returns the closest Container above *op*, or nullptr.
+/// ***************************************************************************
+static BaseObject* GetEnclosingContainer(BaseObject* op)
+{
+  for (BaseObject* up = op->GetUp(); up; up = up->GetUp())
+  {
+    if (up->IsInstanceOf(Ocontainer))
+      return up;
+  }
+  return nullptr;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+static String GetObjectPath(BaseObject* op)
+{
+  String path = op->GetName();
+  for (BaseObject* up = op->GetUp(); up; up = up->GetUp())
+    path = up->GetName() + "/" + path;
+  return path;
+}
+
+/// ***************************************************************************
+/// Collects the nodes inside *root* that take part in the evaluation:
+/// generators, deformers and expression tags. Nested Containers are
+/// profiled on their own and skipped.
+/// ***************************************************************************
+static void CollectCandidates(BaseObject* root, std::vector<std::pair<BaseList2D*, String>>& out)
+{
+  BaseObject* op = root->GetDown();
+  while (op)
+  {
+    if (op->IsInstanceOf(Ocontainer))
+    {
+      op = GetNextNode(op, root, false);
+      continue;
+    }
+    const LONG info = op->GetInfo();
+    if (info & OBJECT_GENERATOR)
+      out.push_back(std::make_pair(op, "Generator"_s));
+    else if (info & OBJECT_MODIFIER)
+      out.push_back(std::make_pair(op, "Deformer"_s));
+    for (BaseTag* tag = op->GetFirstTag(); tag; tag = tag->GetNext())
+    {
+      if (tag->GetInfo() & TAG_EXPRESSION)
+        out.push_back(std::make_pair(static_cast<BaseList2D*>(tag), tag->GetTypeName()));
+    }
+    op = GetNextNode(op, root);
+  }
+}
+
+/// ***************************************************************************
+/// Measures all Containers of *doc*, which must be a clone of the user's
+/// document. Returns false if the profiler was cancelled.
+/// ***************************************************************************
+static Bool ProfileContainers(BaseDocument* doc, LONG frames,
+    std::vector<ProfileContainer>& out, Float* frameMs)
+{
+  TRACE_SCOPE("ProfileContainers");
+  std::vector<ContainerInfo> containers;
+  ContainerFindAll(doc, &containers);
+  for (const ContainerInfo& info : containers)
+  {
+    if (info.isNull) continue;
+    ProfileContainer entry;
+    entry.op = info.op;
+    entry.parent = GetEnclosingContainer(info.op);
+    entry.path = GetObjectPath(info.op);
+    entry.cost.avgMs = entry.cost.peakMs = 0.0;
+    entry.selfMs = 0.0;
+    entry.skipped = 0;
+    out.push_back(entry);
+  }
+  if (out.empty()) return true;
+
+  Profiler profiler(doc, doc->GetTime(), frames);
+  std::vector<Float> baseline;
+  StatusSetText(GeLoadString(IDS_STATUS_PROFILING));
+  if (!profiler.Play(baseline)) return false;
+  *frameMs = 0.0;
+  for (Float ms : baseline)
+    *frameMs += ms;
+  *frameMs /= frames;
+
+  // Inclusive cost of every Container, then subtract the nested ones.
+  for (size_t i = 0; i < out.size(); ++i)
+  {
+    StatusSetBar((LONG) (i * 50 / out.size()));
+    if (!profiler.Measure(out[i].op, true, baseline, &out[i].cost))
+      return false;
+  }
+  for (ProfileContainer& entry : out)
+    entry.selfMs = entry.cost.avgMs;
+  for (ProfileContainer& entry : out)
+  {
+    if (!entry.parent) continue;
+    for (ProfileContainer& parent : out)
+    {
+      if (parent.op == entry.parent)
+        parent.selfMs = std::max<Float>(0.0, parent.selfMs - entry.cost.avgMs);
+    }
+  }
+
+  std::sort(out.begin(), out.end(), [](const ProfileContainer& a, const ProfileContainer& b) {
+    return a.selfMs > b.selfMs;
+  });
+
+  // Break the most expensive Containers down into their nodes.
+  const LONG top = std::min<LONG>(PROFILE_TOPCONTAINERS, (LONG) out.size());
+  for (LONG i = 0; i < top; ++i)
+  {
+    ProfileContainer& entry = out[i];
+    std::vector<std::pair<BaseList2D*, String>> candidates;
+    CollectCandidates(entry.op, candidates);
+    if ((LONG) candidates.size() > PROFILE_MAXCANDIDATES)
+    {
+      entry.skipped = (LONG) candidates.size() - PROFILE_MAXCANDIDATES;
+      candidates.resize(PROFILE_MAXCANDIDATES);
+    }
+    for (size_t j = 0; j < candidates.size(); ++j)
+    {
+      StatusSetBar(50 + (LONG) ((i * candidates.size() + j) * 50 / (top * candidates.size())));
+      ProfileNode node;
+      node.name = candidates[j].first->GetName();
+      node.kind = candidates[j].second;
+      if (!profiler.Measure(candidates[j].first, false, baseline, &node.cost))
+        return false;
+      entry.nodes.push_back(node);
+    }
+    std::sort(entry.nodes.begin(), entry.nodes.end(), [](const ProfileNode& a, const ProfileNode& b) {
+      return a.cost.avgMs > b.cost.avgMs;
+    });
+    if ((LONG) entry.nodes.size() > PROFILE_TOPNODES)
+      entry.nodes.resize(PROFILE_TOPNODES);
+  }
+  return true;
+}
+
+/// ***************************************************************************
+/// Prints the ranking to the console.
+/// ***************************************************************************
+static void PrintReport(const std::vector<ProfileContainer>& containers, LONG frames, Float frameMs)
+{
+  GePrint("Container profile over " + String::IntToString(frames) + " frames, "
+    + RealToString(frameMs, -1, 2) + " ms per frame:");
+  LONG rank = 1;
+  for (const ProfileContainer& entry : containers)
+  {
+    const Float percent = frameMs > 0.0 ? entry.selfMs * 100.0 / frameMs : 0.0;
+    GePrint("  " + String::IntToString(rank++) + ". " + entry.path + ": "
+      + RealToString(entry.selfMs, -1, 2) + " ms self ("
+      + RealToString(percent, -1, 1) + "%), "
+      + RealToString(entry.cost.avgMs, -1, 2) + " ms total, "
+      + RealToString(entry.cost.peakMs, -1, 2) + " ms peak");
+    for (const ProfileNode& node : entry.nodes)
+    {
+      GePrint("       " + node.name + " (" + node.kind + "): "
+        + RealToString(node.cost.avgMs, -1, 2) + " ms, "
+        + RealToString(node.cost.peakMs, -1, 2) + " ms peak");
+    }
+    if (entry.skipped > 0)
+      GePrint("       " + String::IntToString(entry.skipped) + " more nodes not measured");
+  }
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+class ProfileContainersCommand : public CommandData
+{
+public:
+
+  // CommandData
+
+  C4D_APIBRIDGE_COMMANDDATA_EXECUTE(doc)
+  {
+    if (!doc) return false;
+    TRACE_SCOPE("ProfileContainersCommand");
+
+    const LONG fps = doc->GetFps();
+    const LONG current = doc->GetTime().GetFrame(fps);
+    const LONG last = doc->GetLoopMaxTime().GetFrame(fps);
+    const LONG frames = std::max<LONG>(1, std::min<LONG>(PROFILE_FRAMES, last - current + 1));
+
+    BaseDocument* clone = static_cast<BaseDocument*>(doc->GetClone(COPYFLAGS_DOCUMENT, nullptr));
+    if (!clone)
+    {
+      MessageDialog(GeLoadString(IDS_INFO_OUTOFMEMORY));
+      return false;
+    }
+
+    std::vector<ProfileContainer> containers;
+    Float frameMs = 0.0;
+    const Bool ok = ProfileContainers(clone, frames, containers, &frameMs);
+    StatusClear();
+    BaseDocument::Free(clone);
+
+    if (!ok) return true;
+    if (containers.empty())
+    {
+      MessageDialog(GeLoadString(IDS_INFO_PROFILENOCONTAINERS));
+      return true;
+    }
+
+    PrintReport(containers, frames, frameMs);
+    MessageDialog(GeLoadString(IDS_INFO_PROFILEDONE,
+      String::IntToString((LONG) containers.size()), String::IntToString(frames),
+      containers[0].path, RealToString(containers[0].selfMs, -1, 2)));
+    return true;
+  }
+
+};
+
+/// ***************************************************************************
+/// ***************************************************************************
+Bool RegisterContainerProfiler()
+{
+  return RegisterCommandPlugin(
+    ID_COMMAND_PROFILECONTAINERS,
+    GeLoadString(IDS_COMMAND_PROFILECONTAINERS_TITLE),
+    0,
+    nullptr,
+    GeLoadString(IDS_COMMAND_PROFILECONTAINERS_HELP),
+    gNew(ProfileContainersCommand));
+}
@@ -0,0 +1,384 @@
+/// Copyright (C) 2013-2015, Niklas Rosenstein
+/// All rights reserved.
+///
+/// Licensed under the GNU Lesser General Public License.
+///
+/// \file ContainerRegistry.cpp
+///
+/// Per-document index of all Containers and protected Null objects. The
+/// index of a document is rebuilt lazily when its object hierarchy dirty
+/// count changed (insert, remove, load and paste all change it) or after
+/// an undo or redo. The protection state is updated in place by the
+/// protect functions and when a Container is read or copied to, which
+/// is how undo restores it. A rebuild is a single walk over the objects,
+/// which is cheaper than following every insert and remove and is only
+/// done when the registry is used.
+///
+/// Each registry also holds a dynamic BVH over the world bounding boxes
+/// of its Containers. Leaves are added and removed when the index is
+/// rebuilt. A spatial query first moves the leaves whose Container
+/// reports a new ContainerGetSpatialStamp(), so scene execution never
+/// touches the index and documents that are not queried cost nothing.
+///
+/// Registries are keyed by the document address. A scene hook in every
+/// document drops the registry when its document is freed, so render
+/// clones and temporary documents leave no dangling objects behind for
+/// a later document at the same address.
+
+#include <c4d.h>
+#include <c4d_apibridge.h>
+#include <Ocontainer.h>
+#include "ContainerObject.h"
+#include "Utils/Misc.h"
+#include "Utils/Trace.h"
+#include "Utils/DynamicBVH.h"
+
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+
+using c4d_apibridge::IsEmpty;
+
+/// A leaf of the BVH and the spatial stamp of its Container when the
+/// leaf was last moved.
+struct SpatialProxy
+{
+  LONG proxy;
+  UInt32 stamp;
+};
+
+struct DocumentRegistry
+{
+  DocumentRegistry() : hdirty(0), stale(true) { }
+
+  UInt32 hdirty;
+  Bool stale;  ///< Rebuild even if #hdirty is current.
+  std::vector<ContainerInfo> entries;
+  std::unordered_map<BaseObject*, size_t> index;
+  DynamicBVH bvh;
+  std::unordered_map<BaseObject*, SpatialProxy> proxies;
+};
+
+static std::mutex g_registryLock;
+static std::unordered_map<BaseDocument*, DocumentRegistry> g_registries;
+
+/// ***************************************************************************
+/// Drops the registry of its document when the document is freed. The
+/// document is set by GetRegistry() when the registry is created.
+/// ***************************************************************************
+class RegistryHook : public SceneHookData
+{
+public:
+
+  static NodeData* Alloc() { return gNew(RegistryHook); }
+
+  RegistryHook() : m_doc(nullptr) { }
+
+  BaseDocument* m_doc;
+
+  // NodeData
+
+  virtual void Free(GeListNode* node) override
+  {
+    if (!m_doc) return;
+    std::lock_guard<std::mutex> lock(g_registryLock);
+    g_registries.erase(m_doc);
+    m_doc = nullptr;
+  }
+
+  virtual Bool Message(GeListNode* node, LONG type, void* pData) override
+  {
+    // Undo and redo can restore the protection hash of a Null object
+    // without changing the hierarchy.
+    const DocumentInfoData* info = static_cast<DocumentInfoData*>(pData);
+    if (type == MSG_DOCUMENTINFO && info && m_doc && (info->type == MSG_DOCUMENTINFO_TYPE_UNDO
+        || info->type == MSG_DOCUMENTINFO_TYPE_REDO))
+    {
+      std::lock_guard<std::mutex> lock(g_registryLock);
+      auto it = g_registries.find(m_doc);
+      if (it != g_registries.end())
+        it->second.stale = true;
+    }
+    return true;
+  }
+};
+
+/// ***************************************************************************
+/// Fills *info* for *op* without consulting the registry. Returns false
+/// if *op* is not registered.
+/// ***************************************************************************
+static Bool InspectObject(BaseObject* op, BaseObject* parent, ContainerInfo* info)
+{
+  info->op = op;
+  info->parent = parent;
+  if (op->GetType() == Ocontainer)
+  {
+    info->isNull = false;
+    info->isProtected = ContainerIsProtected(op);
+    return true;
+  }
+  BaseContainer* bc = op->GetDataInstance();
+  if (bc && !IsEmpty(bc->GetString(CONTAINEROBJECT_PROTECTIONHASH)))
+  {
+    info->isNull = true;
+    info->isProtected = true;
+    return true;
+  }
+  return false;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+static void ScanHierarchy(BaseObject* op, BaseObject* parent, DocumentRegistry& reg)
+{
+  for (; op; op = op->GetNext())
+  {
+    ContainerInfo info;
+    BaseObject* childParent = parent;
+    if (InspectObject(op, parent, &info))
+    {
+      reg.index[op] = reg.entries.size();
+      reg.entries.push_back(info);
+      childParent = op;
+    }
+    ScanHierarchy(op->GetDown(), childParent, reg);
+  }
+}
+
+/// ***************************************************************************
+/// Removes the leaves of objects that are no longer in the index of
+/// *reg* and adds new Containers to its BVH. The bounds of the other
+/// leaves are refreshed, their object may have moved to another parent.
+/// ***************************************************************************
+static void SyncSpatialIndex(DocumentRegistry& reg)
+{
+  for (auto it = reg.proxies.begin(); it != reg.proxies.end(); )
+  {
+    if (reg.index.count(it->first)) { ++it; continue; }
+    reg.bvh.Remove(it->second.proxy);
+    it = reg.proxies.erase(it);
+  }
+  for (const ContainerInfo& info : reg.entries)
+  {
+    Vector bbmin, bbmax;
+    if (info.isNull || !ContainerGetWorldBounds(info.op, &bbmin, &bbmax)) continue;
+    const UInt32 stamp = ContainerGetSpatialStamp(info.op);
+    auto it = reg.proxies.find(info.op);
+    if (it == reg.proxies.end())
+    {
+      SpatialProxy& entry = reg.proxies[info.op];
+      entry.proxy = reg.bvh.Insert(bbmin, bbmax, info.op);
+      entry.stamp = stamp;
+    }
+    else
+    {
+      reg.bvh.Update(it->second.proxy, bbmin, bbmax);
+      it->second.stamp = stamp;
+    }
+  }
+}
+
+/// ***************************************************************************
+/// Moves the leaves of the Containers in *reg* whose matrix or bounds
+/// changed since their leaf was last updated.
+/// ***************************************************************************
+static void RefreshSpatialIndex(DocumentRegistry& reg)
+{
+  for (auto& it : reg.proxies)
+  {
+    const UInt32 stamp = ContainerGetSpatialStamp(it.first);
+    if (stamp == it.second.stamp) continue;
+    Vector bbmin, bbmax;
+    if (ContainerGetWorldBounds(it.first, &bbmin, &bbmax))
+      reg.bvh.Update(it.second.proxy, bbmin, bbmax);
+    it.second.stamp = stamp;
+  }
+}
+
+/// ***************************************************************************
+/// Returns the up to date registry of *doc*. Must be called with
+/// #g_registryLock held.
+/// ***************************************************************************
+static DocumentRegistry& GetRegistry(BaseDocument* doc)
+{
+  const UInt32 hdirty = doc->GetHDirty(HDIRTYFLAGS_OBJECT_HIERARCHY);
+  auto it = g_registries.find(doc);
+  if (it != g_registries.end() && it->second.hdirty == hdirty && !it->second.stale)
+    return it->second;
+
+  TRACE_SCOPE("ContainerRegistryScan");
+
+  // Without the hook the registry could outlive the document, it is
+  // rebuilt on every call instead.
+  static DocumentRegistry s_uncached;
+  DocumentRegistry* target = &s_uncached;
+  if (it != g_registries.end())
+    target = &it->second;
+  else
+  {
+    BaseSceneHook* node = doc->FindSceneHook(CONTAINEROBJECT_REGISTRY_HOOK);
+    RegistryHook* hook = node ? GetNodeData<RegistryHook>(node) : nullptr;
+    if (hook)
+    {
+      hook->m_doc = doc;
+      target = &g_registries[doc];
+    }
+    else
+      s_uncached = DocumentRegistry();
+  }
+
+  DocumentRegistry& reg = *target;
+  reg.hdirty = hdirty;
+  reg.stale = false;
+  reg.entries.clear();
+  reg.index.clear();
+  ScanHierarchy(doc->GetFirstObject(), nullptr, reg);
+  SyncSpatialIndex(reg);
+  return reg;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+Bool ContainerLookup(BaseObject* op, ContainerInfo* info)
+{
+  if (!op) return false;
+  ContainerInfo dummy;
+  if (!info) info = &dummy;
+
+  BaseDocument* doc = op->GetDocument();
+  if (!doc)
+  {
+    BaseObject* parent = op->GetUp();
+    while (parent && !InspectObject(parent, nullptr, &dummy))
+      parent = parent->GetUp();
+    return InspectObject(op, parent, info);
+  }
+
+  std::lock_guard<std::mutex> lock(g_registryLock);
+  DocumentRegistry& reg = GetRegistry(doc);
+  auto it = reg.index.find(op);
+  if (it == reg.index.end()) return false;
+  *info = reg.entries[it->second];
+  return true;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+LONG ContainerFindAll(BaseDocument* doc, std::vector<ContainerInfo>* out)
+{
+  if (!doc) return 0;
+  std::lock_guard<std::mutex> lock(g_registryLock);
+  DocumentRegistry& reg = GetRegistry(doc);
+  if (out)
+    *out = reg.entries;
+  return (LONG) reg.entries.size();
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+void ContainerRegistryUpdate(BaseObject* op)
+{
+  BaseDocument* doc = op ? op->GetDocument() : nullptr;
+  if (!doc) return;
+  std::lock_guard<std::mutex> lock(g_registryLock);
+  auto it = g_registries.find(doc);
+  if (it == g_registries.end()) return;
+  DocumentRegistry& reg = it->second;
+  auto jt = reg.index.find(op);
+  ContainerInfo info;
+  const Bool registered = InspectObject(op, nullptr, &info);
+  if (jt == reg.index.end() || !registered)
+  {
+    // A Null object gained or lost its protection, the parents of the
+    // objects below it change as well.
+    if (registered != (jt != reg.index.end()))
+      reg.stale = true;
+    return;
+  }
+  ContainerInfo& entry = reg.entries[jt->second];
+  InspectObject(op, entry.parent, &entry);
+}
+
+/// ***************************************************************************
+/// Returns the registry of *doc* with an up to date spatial index. Must
+/// be called with #g_registryLock held.
+/// ***************************************************************************
+static DocumentRegistry& GetSpatialRegistry(BaseDocument* doc)
+{
+  DocumentRegistry& reg = GetRegistry(doc);
+  RefreshSpatialIndex(reg);
+  return reg;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+LONG ContainerQueryBox(BaseDocument* doc, const Vector& bbmin, const Vector& bbmax,
+  std::vector<BaseObject*>* out)
+{
+  if (!doc) return 0;
+  TRACE_SCOPE("ContainerQueryBox");
+  std::lock_guard<std::mutex> lock(g_registryLock);
+  DocumentRegistry& reg = GetSpatialRegistry(doc);
+  LONG count = 0;
+  reg.bvh.QueryBox(bbmin, bbmax, [&](LONG proxy) {
+    if (out) out->push_back(static_cast<BaseObject*>(reg.bvh.GetData(proxy)));
+    ++count;
+    return true;
+  });
+  return count;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+LONG ContainerQueryFrustum(BaseDocument* doc, const ContainerFrustum& frustum,
+  std::vector<BaseObject*>* out)
+{
+  if (!doc) return 0;
+  TRACE_SCOPE("ContainerQueryFrustum");
+  std::lock_guard<std::mutex> lock(g_registryLock);
+  DocumentRegistry& reg = GetSpatialRegistry(doc);
+  LONG count = 0;
+  reg.bvh.QueryPlanes(frustum.normals, frustum.offsets, frustum.count, [&](LONG proxy) {
+    if (out) out->push_back(static_cast<BaseObject*>(reg.bvh.GetData(proxy)));
+    ++count;
+    return true;
+  });
+  return count;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+LONG ContainerQueryRay(BaseDocument* doc, const Vector& origin, const Vector& dir,
+  Float maxDist, std::vector<ContainerRayHit>* out)
+{
+  if (!doc) return 0;
+  TRACE_SCOPE("ContainerQueryRay");
+  std::vector<ContainerRayHit> hits;
+  {
+    std::lock_guard<std::mutex> lock(g_registryLock);
+    DocumentRegistry& reg = GetSpatialRegistry(doc);
+    reg.bvh.QueryRay(origin, dir, maxDist, [&](LONG proxy) {
+      Vector bbmin, bbmax;
+      ContainerRayHit hit;
+      reg.bvh.GetBounds(proxy, &bbmin, &bbmax);
+      hit.op = static_cast<BaseObject*>(reg.bvh.GetData(proxy));
+      if (DynamicBVH::IntersectRay(bbmin, bbmax, origin, dir, maxDist, &hit.distance))
+        hits.push_back(hit);
+      return true;
+    });
+  }
+  std::sort(hits.begin(), hits.end(), [](const ContainerRayHit& a, const ContainerRayHit& b) {
+    return a.distance < b.distance;
+  });
+  if (out)
+    out->insert(out->end(), hits.begin(), hits.end());
+  return (LONG) hits.size();
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+Bool RegisterContainerRegistryHook()
+{
+  return RegisterSceneHookPlugin(CONTAINEROBJECT_REGISTRY_HOOK, "Container Registry"_s,
+    0, RegistryHook::Alloc, 0, 0);
+}
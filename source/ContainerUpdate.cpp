@@ -0,0 +1,562 @@
+/// Copyright (C) 2013-2015, Niklas Rosenstein
+/// All rights reserved.
+///
+/// Licensed under the GNU Lesser General Public License.
+///
+/// \file ContainerUpdate.cpp
+///
+/// Updates a placed Container in place to a newer version of its asset.
+/// The nodes of both hierarchies are matched first, then the matched
+/// nodes are moved where the new version has them, new branches are
+/// cloned in, differing values are written and nodes that were removed
+/// from the asset are deleted. Matched nodes are never replaced, so
+/// their animation tracks and the links pointing to them survive.
+
+#include "ContainerAsset.h"
+#include "ContainerObject.h"
+
+#include <c4d_apibridge.h>
+#include <Ocontainer.h>
+#include "Utils/Misc.h"
+#include "Utils/Suspend.h"
+#include "Utils/Trace.h"
+
+#include <cstring>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+/// ***************************************************************************
+/// ***************************************************************************
+static Int64 GetNodeId(BaseList2D* node)
+{
+  const BaseContainer* bc = node->GetDataInstance();
+  return bc ? bc->GetInt64(CONTAINERASSET_NODEID) : 0;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+Bool ContainerAssignNodeIds(BaseObject* op, BaseDocument* doc)
+{
+  TRACE_SCOPE("ContainerAssignNodeIds");
+  if (!op) return false;
+  static std::mt19937_64 rng(std::random_device()() ^ (UInt64) GeGetTimer());
+
+  // Copies of a node within the Container share its id, they get a new one.
+  std::unordered_set<Int64> seen;
+  Bool changed = false;
+  auto assign = [&](BaseList2D* node) {
+    BaseContainer* bc = node->GetDataInstance();
+    if (!bc) return;
+    Int64 id = bc->GetInt64(CONTAINERASSET_NODEID);
+    if (id != 0 && seen.insert(id).second) return;
+    do id = (Int64) rng(); while (id == 0 || !seen.insert(id).second);
+    if (doc) doc->AddUndo(UNDOTYPE_CHANGE_SMALL, node);
+    bc->SetInt64(CONTAINERASSET_NODEID, id);
+    node->SetDirty(DIRTYFLAGS_DATA);
+    changed = true;
+  };
+  for (NodeIterator<BaseObject> it(op->GetDown(), op); it; ++it)
+  {
+    assign(*it);
+    for (BaseTag* tag = it->GetFirstTag(); tag; tag = tag->GetNext())
+      assign(tag);
+  }
+  if (changed && doc)
+    doc->SetChanged();
+  return changed;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+static std::string ToUtf8(const String& str)
+{
+  std::string result;
+  Char* utf8 = str.GetCStringCopy(STRINGENCODING_UTF8);
+  if (utf8)
+  {
+    result = utf8;
+    DeleteMem(utf8);
+  }
+  return result;
+}
+
+/// ***************************************************************************
+/// The nodes of a hierarchy by id and by path. The path of a node is
+/// made of the names, types and sibling indices from the root down and
+/// is used to match nodes that were placed before ids were assigned.
+/// ***************************************************************************
+struct NodeIndex
+{
+  std::unordered_map<Int64, BaseList2D*> byId;
+  std::unordered_map<std::string, BaseList2D*> byPath;
+  std::unordered_map<BaseList2D*, std::string> paths;
+  std::vector<BaseList2D*> nodes;  ///< Pre-order, tags after their object.
+
+  void Add(BaseList2D* node, const std::string& path)
+  {
+    const Int64 id = GetNodeId(node);
+    if (id != 0)
+      byId.insert(std::make_pair(id, node));
+    byPath.insert(std::make_pair(path, node));
+    paths[node] = path;
+    nodes.push_back(node);
+  }
+
+  void Build(BaseObject* parent, const std::string& parentPath)
+  {
+    std::unordered_map<std::string, LONG> siblings;
+    for (BaseObject* op = parent->GetDown(); op; op = op->GetNext())
+    {
+      std::string key = ToUtf8(op->GetName()) + "#" + std::to_string(op->GetType());
+      key += "#" + std::to_string(siblings[key]++);
+      const std::string path = parentPath + "/" + key;
+      Add(op, path);
+
+      std::unordered_map<LONG, LONG> tags;
+      for (BaseTag* tag = op->GetFirstTag(); tag; tag = tag->GetNext())
+      {
+        const LONG type = tag->GetType();
+        Add(tag, path + "|" + std::to_string(type) + "#" + std::to_string(tags[type]++));
+      }
+      Build(op, path);
+    }
+  }
+};
+
+/// ***************************************************************************
+/// Returns true for the internal point and polygon tags. Their data is
+/// compared and copied with the object in SyncGeometry().
+/// ***************************************************************************
+static Bool IsGeometryTag(BaseTag* tag)
+{
+  return tag->GetType() == Tpoint || tag->GetType() == Tpolygon;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+class ContainerUpdater
+{
+public:
+
+  ContainerUpdater(BaseDocument* doc, BaseDocument* srcDoc, ContainerUpdateStats& stats)
+  : m_doc(doc), m_srcDoc(srcDoc), m_stats(stats) { }
+
+  void Run(BaseObject* op, BaseObject* source)
+  {
+    m_old.Build(op, "");
+    m_new.Build(source, "");
+    MapMaterials();
+    Match();
+    SyncChildren(op, source);
+    SyncData(op, source, true);
+
+    // Objects first, variable tags are only copied if the geometry of
+    // their object changed.
+    for (BaseList2D* node : m_new.nodes)
+    {
+      BaseList2D* old = Lookup(node);
+      if (old && !m_cloned.count(old) && node->IsInstanceOf(Obase))
+        SyncNode(old, node);
+    }
+    for (BaseList2D* node : m_new.nodes)
+    {
+      BaseList2D* old = Lookup(node);
+      if (old && !m_cloned.count(old) && !node->IsInstanceOf(Obase) && !IsGeometryTag(static_cast<BaseTag*>(node)))
+        SyncNode(old, node);
+    }
+    for (BaseList2D* clone : m_clonedRoots)
+      TranslateBranch(clone);
+    RemoveStale();
+  }
+
+private:
+
+  /// Maps the materials of the asset to materials of the same name in
+  /// the target document. Missing materials are copied over.
+  void MapMaterials()
+  {
+    if (!m_srcDoc || !m_doc) return;
+    for (BaseMaterial* mat = m_srcDoc->GetFirstMaterial(); mat; mat = mat->GetNext())
+    {
+      BaseMaterial* target = m_doc->SearchMaterial(mat->GetName());
+      if (!target)
+      {
+        target = static_cast<BaseMaterial*>(mat->GetClone(COPYFLAGS_0, nullptr));
+        if (!target) continue;
+        m_doc->InsertMaterial(target);
+        m_doc->AddUndo(UNDOTYPE_NEW, target);
+      }
+      m_map[mat] = target;
+    }
+  }
+
+  /// Pairs every node of the new version with a node of the placed
+  /// Container. Each old node is used at most once.
+  void Match()
+  {
+    for (BaseList2D* node : m_new.nodes)
+    {
+      BaseList2D* match = nullptr;
+      const Int64 id = GetNodeId(node);
+      auto byId = (id != 0) ? m_old.byId.find(id) : m_old.byId.end();
+      if (byId != m_old.byId.end())
+        match = byId->second;
+      else
+      {
+        auto byPath = m_old.byPath.find(m_new.paths[node]);
+        if (byPath != m_old.byPath.end() && GetNodeId(byPath->second) == 0)
+          match = byPath->second;
+      }
+      if (match && match->GetType() == node->GetType() && m_claimed.insert(match).second)
+        m_map[node] = match;
+    }
+  }
+
+  BaseList2D* Lookup(BaseList2D* node) const
+  {
+    auto it = m_map.find(node);
+    return it != m_map.end() ? it->second : nullptr;
+  }
+
+  /// Records the clones of a new branch in the map so that links into
+  /// it can be translated.
+  void MapClones(BaseObject* src, BaseObject* clone)
+  {
+    m_map[src] = clone;
+    m_cloned.insert(clone);
+    BaseTag* ct = clone->GetFirstTag();
+    for (BaseTag* st = src->GetFirstTag(); st && ct; st = st->GetNext(), ct = ct->GetNext())
+    {
+      m_map[st] = ct;
+      m_cloned.insert(ct);
+    }
+    BaseObject* cc = clone->GetDown();
+    for (BaseObject* sc = src->GetDown(); sc && cc; sc = sc->GetNext(), cc = cc->GetNext())
+      MapClones(sc, cc);
+  }
+
+  /// Brings the children of *oldParent* into the order of the children
+  /// of *newParent*, moving matched objects and cloning new branches.
+  void SyncChildren(BaseObject* oldParent, BaseObject* newParent)
+  {
+    BaseObject* pred = nullptr;
+    for (BaseObject* child = newParent->GetDown(); child; child = child->GetNext())
+    {
+      BaseObject* old = static_cast<BaseObject*>(Lookup(child));
+      if (old)
+      {
+        if (old->GetUp() != oldParent || old->GetPred() != pred)
+        {
+          m_doc->AddUndo(UNDOTYPE_CHANGE, old);
+          old->Remove();
+          Insert(old, oldParent, pred);
+        }
+        SyncTags(old, child);
+        SyncChildren(old, child);
+      }
+      else
+      {
+        old = static_cast<BaseObject*>(child->GetClone(COPYFLAGS_0, nullptr));
+        if (!old) continue;
+        Insert(old, oldParent, pred);
+        m_doc->AddUndo(UNDOTYPE_NEW, old);
+        MapClones(child, old);
+        m_clonedRoots.push_back(old);
+        ++m_stats.added;
+      }
+      pred = old;
+    }
+  }
+
+  static void Insert(BaseObject* op, BaseObject* parent, BaseObject* pred)
+  {
+    if (pred)
+      op->InsertAfter(pred);
+    else
+      op->InsertUnder(parent);
+  }
+
+  /// Returns the tag before *tag*, ignoring the geometry tags which
+  /// SyncTags() doesn't order.
+  static BaseTag* GetTagPred(BaseTag* tag)
+  {
+    BaseTag* pred = tag->GetPred();
+    while (pred && IsGeometryTag(pred))
+      pred = pred->GetPred();
+    return pred;
+  }
+
+  /// Brings the tags of *old* into the order of the tags of *src*.
+  void SyncTags(BaseObject* old, BaseObject* src)
+  {
+    BaseTag* pred = nullptr;
+    for (BaseTag* tag = src->GetFirstTag(); tag; tag = tag->GetNext())
+    {
+      if (IsGeometryTag(tag)) continue;
+      BaseTag* match = static_cast<BaseTag*>(Lookup(tag));
+      if (match)
+      {
+        if (match->GetObject() != old || GetTagPred(match) != pred)
+        {
+          m_doc->AddUndo(UNDOTYPE_CHANGE, match);
+          match->Remove();
+          old->InsertTag(match, pred);
+        }
+      }
+      else
+      {
+        match = static_cast<BaseTag*>(tag->GetClone(COPYFLAGS_0, nullptr));
+        if (!match) continue;
+        old->InsertTag(match, pred);
+        m_doc->AddUndo(UNDOTYPE_NEW, match);
+        m_map[tag] = match;
+        m_cloned.insert(match);
+        m_clonedRoots.push_back(match);
+        ++m_stats.added;
+      }
+      pred = match;
+    }
+  }
+
+  /// Parameters that belong to the placed copy and are never updated.
+  static Bool IsLocalParameter(LONG id, Bool root)
+  {
+    if (id == CONTAINEROBJECT_SUSPENDSTATE) return true;
+    if (!root) return false;
+    switch (id)
+    {
+      case NRCONTAINER_INFO_NAME:
+      case NRCONTAINER_INFO_VERSION:
+      case NRCONTAINER_INFO_URL:
+      case NRCONTAINER_INFO_AUTHOR:
+      case NRCONTAINER_INFO_AUTHOR_EMAIL:
+      case NRCONTAINER_INFO_DESCRIPTION:
+        return false;
+    }
+    return true;
+  }
+
+  /// Returns *data* with links into the asset replaced by links to the
+  /// matching nodes of the placed Container, including the links in
+  /// sub-containers and InExclude lists.
+  GeData Translate(const GeData& data) const
+  {
+    BaseContainer bc;
+    bc.SetData(0, data);
+    if (!TranslateLinks(&bc, m_srcDoc, m_map)) return data;
+    return *bc.GetDataPointer(0);
+  }
+
+  /// Writes the values of *src* that differ to *old*. Only the Info
+  /// parameters are updated on the Container itself (*root*).
+  void SyncData(BaseList2D* old, BaseList2D* src, Bool root)
+  {
+    BaseContainer* ob = old->GetDataInstance();
+    const BaseContainer* nb = src->GetDataInstance();
+    if (!ob || !nb) return;
+
+    std::vector<LONG> removed;
+    LONG id;
+    for (LONG i = 0; (id = ob->GetIndexId(i)) != NOTOK; ++i)
+    {
+      if (!IsLocalParameter(id, root) && !nb->GetDataPointer(id))
+        removed.push_back(id);
+    }
+
+    LONG changed = 0;
+    for (LONG i = 0; (id = nb->GetIndexId(i)) != NOTOK; ++i)
+    {
+      if (IsLocalParameter(id, root)) continue;
+      const GeData value = Translate(*nb->GetIndexData(i));
+      const GeData* current = ob->GetDataPointer(id);
+      if (current && *current == value) continue;
+      if (changed++ == 0 && removed.empty())
+        m_doc->AddUndo(UNDOTYPE_CHANGE_SMALL, old);
+      ob->SetData(id, value);
+    }
+    if (!removed.empty())
+    {
+      if (changed == 0)
+        m_doc->AddUndo(UNDOTYPE_CHANGE_SMALL, old);
+      for (LONG rid : removed)
+        ob->RemoveData(rid);
+    }
+    Count(old, changed + (LONG) removed.size());
+  }
+
+  void Count(BaseList2D* node, LONG changes)
+  {
+    if (changes == 0) return;
+    m_stats.parameters += changes;
+    if (m_changed.insert(node).second)
+      ++m_stats.changed;
+    node->SetDirty(DIRTYFLAGS_DATA);
+  }
+
+  /// Updates a matched object or tag. The matrix of objects is only
+  /// written if it isn't animated.
+  void SyncNode(BaseList2D* old, BaseList2D* src)
+  {
+    SyncData(old, src, false);
+    if (old->GetName() != src->GetName())
+    {
+      m_doc->AddUndo(UNDOTYPE_CHANGE_SMALL, old);
+      old->SetName(src->GetName());
+      Count(old, 1);
+    }
+    if (old->IsInstanceOf(Obase))
+    {
+      BaseObject* op = static_cast<BaseObject*>(old);
+      BaseObject* sop = static_cast<BaseObject*>(src);
+      if (!op->GetFirstCTrack() && op->GetMl() != sop->GetMl())
+      {
+        m_doc->AddUndo(UNDOTYPE_CHANGE_SMALL, op);
+        op->SetMl(sop->GetMl());
+        Count(op, 1);
+      }
+      if (op->IsInstanceOf(Opoint) && sop->IsInstanceOf(Opoint))
+        SyncGeometry(static_cast<PointObject*>(op), static_cast<PointObject*>(sop));
+    }
+    else if (old->IsInstanceOf(Tvariable) && m_geometryChanged.count(static_cast<BaseTag*>(old)->GetObject()))
+    {
+      // Variable tags hold per point or polygon data that follows the
+      // geometry, they are copied with it.
+      m_doc->AddUndo(UNDOTYPE_CHANGE, old);
+      src->CopyTo(old, COPYFLAGS_NO_HIERARCHY | COPYFLAGS_NO_BRANCHES, nullptr);
+      Count(old, 1);
+    }
+  }
+
+  void SyncGeometry(PointObject* op, PointObject* src)
+  {
+    const LONG pcnt = src->GetPointCount();
+    Bool differ = op->GetPointCount() != pcnt
+      || std::memcmp(op->GetPointR(), src->GetPointR(), pcnt * sizeof(Vector)) != 0;
+    LONG vcnt = 0;
+    if (op->IsInstanceOf(Opolygon) && src->IsInstanceOf(Opolygon))
+    {
+      PolygonObject* poly = static_cast<PolygonObject*>(op);
+      PolygonObject* spoly = static_cast<PolygonObject*>(src);
+      vcnt = spoly->GetPolygonCount();
+      differ = differ || poly->GetPolygonCount() != vcnt
+        || std::memcmp(poly->GetPolygonR(), spoly->GetPolygonR(), vcnt * sizeof(CPolygon)) != 0;
+    }
+    if (!differ) return;
+
+    m_doc->AddUndo(UNDOTYPE_CHANGE, op);
+    if (op->IsInstanceOf(Opolygon))
+    {
+      PolygonObject* poly = static_cast<PolygonObject*>(op);
+      if (!poly->ResizeObject(pcnt, vcnt)) return;
+      std::memcpy(poly->GetPolygonW(), static_cast<PolygonObject*>(src)->GetPolygonR(), vcnt * sizeof(CPolygon));
+    }
+    else if (!op->ResizeObject(pcnt))
+      return;
+    std::memcpy(op->GetPointW(), src->GetPointR(), pcnt * sizeof(Vector));
+    op->Message(MSG_UPDATE);
+    m_geometryChanged.insert(op);
+    Count(op, 1);
+  }
+
+  /// Redirects the links of a cloned branch into the asset to the
+  /// matching nodes of the placed Container.
+  void TranslateBranch(BaseList2D* root)
+  {
+    auto translate = [this](BaseList2D* node) {
+      TranslateLinks(node->GetDataInstance(), m_srcDoc, m_map);
+    };
+    translate(root);
+    if (!root->IsInstanceOf(Obase)) return;
+    BaseObject* op = static_cast<BaseObject*>(root);
+    for (NodeIterator<BaseObject> it(op, op); it; ++it)
+    {
+      if (*it != op) translate(*it);
+      for (BaseTag* tag = it->GetFirstTag(); tag; tag = tag->GetNext())
+        translate(tag);
+    }
+  }
+
+  /// Returns the object that *node* belongs to: its parent for objects
+  /// and its host for tags.
+  static BaseObject* GetOwner(BaseList2D* node)
+  {
+    return node->IsInstanceOf(Obase) ? static_cast<BaseObject*>(node)->GetUp()
+      : static_cast<BaseTag*>(node)->GetObject();
+  }
+
+  /// Deletes the nodes that came from the asset (they have an id) but
+  /// are not part of the new version. Nodes without an id were added
+  /// to the placed copy by hand and are kept, together with the stale
+  /// objects they are attached to.
+  void RemoveStale()
+  {
+    std::unordered_set<BaseList2D*> stale;
+    for (BaseList2D* node : m_old.nodes)
+    {
+      const Int64 id = GetNodeId(node);
+      if (id != 0 && !m_claimed.count(node) && !m_new.byId.count(id))
+        stale.insert(node);
+    }
+    for (BaseList2D* node : m_old.nodes)
+    {
+      if (GetNodeId(node) != 0) continue;
+      if (!node->IsInstanceOf(Obase) && IsGeometryTag(static_cast<BaseTag*>(node))) continue;
+      for (BaseObject* up = GetOwner(node); up; up = up->GetUp())
+        stale.erase(up);
+    }
+
+    // Collect the outermost stale nodes before anything is freed, the
+    // children and tags of an object are deleted with it.
+    std::vector<BaseList2D*> roots;
+    for (BaseList2D* node : m_old.nodes)
+    {
+      if (!stale.count(node)) continue;
+      Bool inside = false;
+      for (BaseObject* up = GetOwner(node); up && !inside; up = up->GetUp())
+        inside = stale.count(up) != 0;
+      if (!inside) roots.push_back(node);
+    }
+    for (BaseList2D* node : roots)
+    {
+      m_doc->AddUndo(UNDOTYPE_DELETE, node);
+      node->Remove();
+      BaseList2D::Free(node);
+      ++m_stats.removed;
+    }
+  }
+
+  BaseDocument* m_doc;
+  BaseDocument* m_srcDoc;
+  ContainerUpdateStats& m_stats;
+  NodeIndex m_old;
+  NodeIndex m_new;
+  LinkMap m_map;  ///< New node to placed node.
+  std::unordered_set<BaseList2D*> m_claimed;
+  std::unordered_set<BaseList2D*> m_cloned;
+  std::unordered_set<BaseList2D*> m_changed;
+  std::unordered_set<BaseObject*> m_geometryChanged;
+  std::vector<BaseList2D*> m_clonedRoots;
+};
+
+/// ***************************************************************************
+/// ***************************************************************************
+Bool ContainerAssetUpdate(BaseObject* op, BaseObject* source, BaseDocument* doc,
+  ContainerUpdateStats* stats)
+{
+  TRACE_SCOPE("ContainerAssetUpdate");
+  if (!op || !source || !doc) return false;
+  if (op->GetType() != Ocontainer || source->GetType() != Ocontainer) return false;
+  if (ContainerIsProtected(op) || ContainerIsBusy(op) || ContainerIsPacked(op)) return false;
+  const BaseContainer* bc = op->GetDataInstance();
+  if (!bc || bc->GetLink(NRCONTAINER_INSTANCE_MASTER, doc)) return false;
+
+  ContainerUpdateStats local = { 0, 0, 0, 0 };
+  ContainerUpdater updater(doc, source->GetDocument(), stats ? *stats : local);
+  updater.Run(op, source);
+  op->SetDirty(DIRTYFLAGS_DATA);
+  ContainerRegistryUpdate(op);
+  return true;
+}
@@ -0,0 +1,1047 @@
+/// Generated by tools/embed_icons.py from res/img. Do not edit.
+///
+/// \file Generated/EmbeddedIcons.cpp
+
+#include "EmbeddedIcons.h"
+
+namespace EmbeddedIcons {
+
+static constexpr UInt32 ocontainer_pixels[4096] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xFFDB5D0A, 0xFFDB5D11,
+  0xFFDB5D11, 0xFFDB5D11, 0xFFDB5D11, 0xFFDB5D0F, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0xFFDB5D2F, 0xFFDB5DFF, 0xFFDB5DFF,
+  0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF,
+  0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFE, 0xFFDB5DFC, 0xFFDB5D3A, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0xFFDB5DBA, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF,
+  0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF,
+  0xFFDB5DCE, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0xFFDB5D43, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF,
+  0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF,
+  0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5D40, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0xFFDB5D03, 0xFFDB5DD2, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF,
+  0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF,
+  0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DC4, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xFFDB5DAD,
+  0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF,
+  0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF,
+  0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5D43, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0xFFDB5D04, 0xFFDB5DFC, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF,
+  0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF,
+  0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DCC, 0xFFDB5D01, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0xFFDB5D97, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF,
+  0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF,
+  0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5D52,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0xFFDB5D0A, 0xFFDB5DFB, 0xFFDB5DFF,
+  0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF,
+  0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF,
+  0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DCD, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xFFDB5D0C,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0, 0, 0, 0,
+  0, 0, 0, 0xFFDB5D01, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0, 0, 0, 0, 0, 0, 0, 0, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0, 0, 0, 0, 0, 0, 0, 0,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0, 0, 0, 0,
+  0, 0, 0, 0, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0, 0, 0, 0, 0, 0, 0, 0, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0, 0, 0, 0, 0, 0, 0, 0,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0, 0, 0, 0,
+  0, 0, 0, 0, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0, 0, 0, 0, 0, 0, 0, 0, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0, 0, 0, 0, 0, 0, 0, 0,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0, 0, 0, 0,
+  0, 0, 0, 0, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0, 0, 0, 0, 0, 0, 0, 0, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0, 0, 0, 0, 0, 0, 0, 0,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0, 0, 0, 0,
+  0, 0, 0, 0, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0, 0, 0, 0, 0, 0, 0, 0, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0, 0, 0, 0, 0, 0, 0, 0,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0, 0, 0, 0,
+  0, 0, 0, 0, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0, 0, 0, 0, 0, 0, 0, 0, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0, 0, 0, 0, 0, 0, 0, 0,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDDAC03FF, 0xDDAC03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0, 0, 0, 0,
+  0, 0, 0, 0, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDDAC04FF, 0xDDAC04FF, 0xDDAC04FF, 0xDDAC03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0, 0, 0, 0, 0, 0, 0, 0, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDDAC03FF,
+  0xDDAC04FF, 0xDDAC04FF, 0xDDAC04FF, 0xDDAC03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0, 0, 0, 0, 0, 0, 0, 0,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDDAC03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0, 0, 0, 0,
+  0, 0, 0, 0, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0, 0, 0, 0, 0, 0, 0, 0, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0, 0, 0, 0, 0, 0, 0, 0,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0, 0, 0, 0,
+  0, 0, 0, 0, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0, 0, 0, 0, 0, 0, 0, 0, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0, 0, 0, 0, 0, 0, 0, 0,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0, 0, 0, 0,
+  0, 0, 0, 0, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0, 0, 0, 0, 0, 0, 0, 0, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0, 0, 0, 0, 0, 0, 0, 0,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0, 0, 0, 0,
+  0, 0, 0, 0, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0, 0, 0, 0, 0, 0, 0, 0, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDDAC03FF, 0xDDAC04FF, 0xDDAC04FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0, 0, 0, 0, 0, 0, 0, 0,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDDAC04FF, 0xDEAD05FF, 0xDFAE05FF, 0xDEAD05FF, 0xDDAC04FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0, 0, 0, 0,
+  0, 0, 0, 0, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDEAD04FF, 0xDFAE05FF, 0xE0AF06FF, 0xE0AF06FF, 0xDEAD05FF, 0xDDAC04FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0, 0, 0, 0, 0, 0, 0, 0, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDEAD04FF, 0xDFAE06FF, 0xE1B007FF,
+  0xE2B108FF, 0xE1B007FF, 0xDFAE05FF, 0xDDAC03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0,
+};
+constexpr EmbeddedIcon ocontainer = { 64, 64, ocontainer_pixels };
+
+static constexpr UInt32 null2container_pixels[4096] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x80808010,
+  0x37373760, 0x32323290, 0x323232A0, 0x37373770, 0x80808010, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0x80808001, 0, 0x3433337C, 0x7276721E, 0, 0x80808001, 0, 0, 0, 0, 0,
+  0, 0, 0x37373767, 0x373839FF, 0x687180FF, 0x8291A6FF, 0x8B9BB3FF, 0x707C8DFF, 0x373839FF, 0x32323287, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0x80808003, 0, 0x524C5227, 0x393939FF, 0x3838387A, 0, 0x80808004, 0,
+  0, 0, 0, 0, 0, 0x43434337, 0x373839FF, 0xA5BBD9FF, 0xBFD9FFFF, 0xBFD9FFFF, 0xBFD9FFFF, 0xBFD9FFFF,
+  0xB7CFF3FF, 0x474D53FF, 0x37373757, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0x80808003, 0, 0x2F302F9C, 0xB6B5B6FF,
+  0x575855E1, 0x80808011, 0, 0x80808001, 0, 0, 0, 0, 0, 0x323232A0, 0x8B9BB3FF, 0xBFD9FFFF,
+  0xBFD9FFFF, 0xBFD9FFFF, 0xB7CFF3FF, 0xBFD9FFFF, 0xBFD9FFFF, 0x9CB0CDFF, 0x323232C0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x80808002,
+  0, 0x3232322A, 0x616061FB, 0xF8F8F8FD, 0xA2A2A2FF, 0x2C2D2C78, 0, 0x80808004, 0, 0, 0, 0,
+  0x80808010, 0x373839FF, 0xBFD9FFFF, 0xBFD9FFFF, 0xBFD9FFFF, 0x3D3F45FF, 0x373839FF, 0xB7CFF3FF, 0xBFD9FFFF, 0xBFD9FFFF, 0x474D53FF, 0x43434330,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0x80808004, 0, 0x2F2E2F97, 0xBBBBBAFF, 0xF1F0F1FA, 0xDFE0DFFF, 0x4B494CE5, 0x80808011, 0,
+  0x80808001, 0, 0, 0, 0x37373740, 0x515862FF, 0xBFD9FFFF, 0xBFD9FFFF, 0x9CB0CDFF, 0x323232C0, 0x32323290, 0x8291A6FF,
+  0xBFD9FFFF, 0xBFD9FFFF, 0x707C8DFF, 0x37373770, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0x80808003, 0, 0x44444422, 0x686968F5, 0xECECEDFF, 0xE0E1E1FE,
+  0xF2F1F2FC, 0xA6A6A5FF, 0x2C2C2C6F, 0, 0x80808005, 0, 0, 0, 0x32323280, 0x798799FF, 0xBFD9FFFF, 0xBFD9FFFF,
+  0x798799FF, 0x32323280, 0x32323280, 0x798799FF, 0xBFD9FFFF, 0xBFD9FFFF, 0x798799FF, 0x32323280, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x80808002, 0,
+  0x2F2F2FA3, 0xB4B3B4FF, 0xE9EBE9FA, 0xE3E2E3FF, 0xE4E6E4FC, 0xD8D7D8FF, 0x494949EC, 0x80808014, 0, 0x80808002, 0, 0,
+  0x32323280, 0x798799FF, 0xBFD9FFFF, 0xBFD9FFFF, 0x798799FF, 0x32323280, 0x37373750, 0x5C6471FF, 0xBFD9FFFF, 0xBFD9FFFF, 0x9CB0CDFF, 0x323232C0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0x80808001, 0, 0x80808018, 0x363536BB, 0x3C3C3CD9, 0x959595FF, 0xF3F4F3FE, 0xC7C7C8FF, 0x4B4E4BE5, 0x383838D2, 0x3434334F,
+  0, 0x80808002, 0, 0, 0x32323280, 0x798799FF, 0xBFD9FFFF, 0xBFD9FFFF, 0x798799FF, 0x32323280, 0x37373740, 0x515862FF,
+  0xBFD9FFFF, 0xBFD9FFFF, 0x9CB0CDFF, 0x323232C0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0x80808006, 0, 0x2929293C, 0x888988FF, 0xFAF9FAF9,
+  0xC5C5C5FF, 0x2F2F2F8E, 0, 0x80808005, 0, 0, 0, 0, 0x32323280, 0x798799FF, 0xBFD9FFFF, 0xBFD9FFFF,
+  0x798799FF, 0x32323280, 0x37373750, 0x5C6471FF, 0xBFD9FFFF, 0xBFD9FFFF, 0x9CB0CDFF, 0x323232C0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x80808002,
+  0, 0x29292940, 0x8C8C8CFF, 0xF9FAF9F9, 0xC6C6C6FF, 0x36363690, 0, 0x80808002, 0, 0, 0, 0,
+  0x32323280, 0x798799FF, 0xBFD9FFFF, 0xBFD9FFFF, 0x798799FF, 0x32323280, 0x32323280, 0x798799FF, 0xBFD9FFFF, 0xBFD9FFFF, 0x798799FF, 0x32323280,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0x80808003, 0, 0x28282840, 0x8B8B8BFF, 0xFAF9FAF9, 0xC6C6C5FF, 0x34333490, 0, 0x80808003,
+  0, 0, 0, 0, 0x37373740, 0x515862FF, 0xBFD9FFFF, 0xBFD9FFFF, 0x9CB0CDFF, 0x323232C0, 0x32323290, 0x8291A6FF,
+  0xBFD9FFFF, 0xBFD9FFFF, 0x707C8DFF, 0x37373770, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0x80808003, 0, 0x2B2C2B3F, 0x8C8B8CFF, 0xF9FAF9F9,
+  0xC6C6C6FF, 0x3434348F, 0, 0x80808003, 0, 0, 0, 0, 0x80808010, 0x373839FF, 0xBFD9FFFF, 0xBFD9FFFF,
+  0xBFD9FFFF, 0x3D3F45FF, 0x373839FF, 0xB7CFF3FF, 0xBFD9FFFF, 0xBFD9FFFF, 0x474D53FF, 0x43434330, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x80808003,
+  0, 0x28282840, 0x8B8B8BFF, 0xFAF8F9F9, 0xC5C6C5FF, 0x3434348F, 0, 0x80808003, 0, 0, 0, 0,
+  0, 0x323232A0, 0x8B9BB3FF, 0xBFD9FFFF, 0xBFD9FFFF, 0xBFD9FFFF, 0xB7CFF3FF, 0xBFD9FFFF, 0xBFD9FFFF, 0x9CB0CDFF, 0x323232C0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0x80808003, 0, 0x28282840, 0x8C8B8CFF, 0xF9FAF9F9, 0xC6C6C6FF, 0x3434348F, 0, 0x80808003,
+  0, 0, 0, 0, 0, 0x43434337, 0x373839FF, 0xA5BBD9FF, 0xBFD9FFFF, 0xBFD9FFFF, 0xBFD9FFFF, 0xBFD9FFFF,
+  0xB7CFF3FF, 0x474D53FF, 0x37373757, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0x80808003, 0, 0x28282840, 0x8B8B8BFF, 0xFAF9FAF9,
+  0xC6C6C5FF, 0x34343490, 0, 0x80808003, 0, 0, 0, 0, 0, 0, 0x37373767, 0x373839FF,
+  0x707C8DFF, 0x94A6C0FF, 0x94A6C0FF, 0x707C8DFF, 0x373839FF, 0x32323287, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x80808003,
+  0, 0x2B2C2B3F, 0x8C8B8CFF, 0xF9FAF9F9, 0xC6C6C6FF, 0x3435358F, 0, 0x80808003, 0, 0, 0, 0,
+  0, 0, 0xFFDC5D0A, 0xEECF617B, 0x7C7044AC, 0x524C38D1, 0x524C38D1, 0x7C7044AC, 0xEDCE6174, 0xFFDB5D6B, 0xFFDB5D6B, 0xFFDB5D6B,
+  0xFFDB5D6B, 0xFEDB5D6B, 0xFFDB5D70, 0xFFDB5D76, 0xFFDB5D76, 0xFFDB5D76, 0xFFDD5E59, 0xFFDB5D01, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0x80808003, 0, 0x28282840, 0x8B8B8BFF, 0xFAF8FAF9, 0xC5C6C6FF, 0x34343490, 0, 0x80808003,
+  0, 0, 0, 0, 0, 0, 0xFFDC5DA0, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFEDA5DFF, 0xFEDA5DFF,
+  0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDC5DF4, 0xFFDC5D29,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0x80808003, 0, 0x28282840, 0x8C8B8CFF, 0xF9FAF9F9,
+  0xC6C6C6FF, 0x3434348F, 0, 0x80808003, 0, 0, 0, 0, 0, 0xFFE05F2A, 0xFFDC5DFF, 0xFFDB5DFF,
+  0xFFDB5DFF, 0xFDD95DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFDD95DFF, 0xFEDA5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF,
+  0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDC5D8C, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x80808003,
+  0, 0x28282840, 0x8B8B8BFF, 0xFAF9FAF9, 0xC6C6C6FF, 0x35353591, 0, 0x80808006, 0x80808003, 0x80808003, 0x80808003, 0x80808003,
+  0xE3D2690E, 0xFDDA5DC2, 0xFDD95DFF, 0xFCD85DFF, 0xFFDB5DFF, 0xC4AB52FF, 0x71663DFF, 0xE2C357FF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFDD95DFF, 0xFEDA5DFF,
+  0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFE05F17, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0x80808003, 0, 0x2B2C2B3F, 0x8C8B8CFF, 0xFAFAF9F9, 0xC5C5C5FF, 0x2F2F2F89, 0, 0,
+  0, 0, 0, 0, 0xFFDB5D24, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xC3A94EFF, 0x797879FF, 0x73736DFF,
+  0x827340FF, 0xE2C357FF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFDD95DFF, 0xFEDA5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDC5DFF,
+  0xFFDB5DBE, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0x80808003, 0, 0x28282840, 0x8B8B8BFF, 0xF6F4F6FB,
+  0xC6C7C6FF, 0x474647E3, 0x464946BC, 0x4A484AC0, 0x494949BF, 0x49494BBF, 0x494B49BF, 0x4A484AC0, 0x716A4DF6, 0x776D4FFF, 0x766F4EFF, 0x766C4EFF,
+  0x7A7351FF, 0x5C5640FF, 0xA5A7A4FF, 0xF3F3F3FF, 0xBABABAFF, 0x656460FF, 0x837440FF, 0xEACA5CFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFEDA5DFF, 0xFFDB5DFF,
+  0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDC5DFB, 0xFFDC5D40, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xE6B30301,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x80808003,
+  0, 0x2B2C2B3F, 0x8F8E8FFF, 0xF7F8F7F9, 0xE7E6E6FC, 0xDEDFDEFF, 0xE0E0E0FF, 0xDFE0E0FF, 0xE0DFE0FF, 0xDEDEDEFF, 0xDEDEDEFF, 0xDEDEDEFF,
+  0xDEDEDEFF, 0xDEDEDEFF, 0xDEDEDEFF, 0xDEDEDEFF, 0xDFDEDEFF, 0xDDDDDDFF, 0xDFDFDFFF, 0xE2E3E3FF, 0xECECEAFF, 0xE8E8E8FF, 0xC0C0C0FF, 0x65645FFF,
+  0x726022FF, 0xD5AB1BFF, 0xE0B10FFF, 0xDFB00FFF, 0xE0B10FFF, 0xE0B10FFF, 0xE0B10EFE, 0xE0B10FFF, 0xE0B10EFE, 0xDCAC05E2, 0xDCAB03DD, 0xDCAB03DD,
+  0xDCAB03DD, 0xDCAB03DD, 0xDCAB03DD, 0xDCAB03DD, 0xDCAB03DD, 0xDCAB03DD, 0xDCAB03DD, 0xDCAB03DD, 0xDCAB03DD, 0xDCAB03DD, 0xDCAB03DD, 0xDCAB03DD,
+  0xDCAB03DD, 0xDCAB03DD, 0xDCAB03B0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0x80808003, 0, 0x29292943, 0x878787FF, 0xDDDDDDFF, 0xD3D4D3FF, 0xD7D7D7FF, 0xD6D7D6FF, 0xD6D6D7FF,
+  0xD8D8D7FF, 0xDEDDDEFF, 0xDDDEDEFF, 0xDEDDDEFF, 0xDDDEDDFF, 0xDEDDDEFF, 0xDDDEDDFF, 0xDEDDDEFF, 0xDEDEDDFF, 0xDDDCDDFF, 0xDDDFDFFF, 0xE3E2E3FF,
+  0xEBECE8FF, 0xEAE9EAFF, 0xC1C1C1FF, 0x62615FFF, 0x715E1EFF, 0xD1A510FF, 0xDCAB03FF, 0xDBAA03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03CC, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0x80808002, 0, 0x3B403B30, 0x373737CA, 0x424342BD,
+  0x3F3F3FC0, 0x3F403FBF, 0x3F3D3FC0, 0x3F3F3FBF, 0x403F40C0, 0x494B49BF, 0x645C44E5, 0x6D6337FF, 0x6E6038FF, 0x6D6337FF, 0x6E6138FF, 0x6D6136FF,
+  0x72643AFF, 0x554E30FF, 0xA6A5A6FF, 0xF3F4F3FF, 0xBABABAFF, 0x66675FFF, 0x74601BFF, 0xC79D0BFF, 0xDCAB03FF, 0xDCAB03FF, 0xDBAA03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03CC, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xDDAC0357, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xA9860DFF, 0x777777FF, 0x726E6BFF, 0x74601BFF, 0xC49A0AFF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDAAA04FF, 0xDBAA03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03CC, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0x80808004, 0x80808003, 0x80808004, 0x80808003, 0x80808003, 0x80808003,
+  0x80808004, 0x80808003, 0xD9AA0759, 0xDAAA04FF, 0xDAAA04FF, 0xDAAA04FF, 0xDAAA04FF, 0xDAAA05FF, 0xDCAB03FF, 0xAC8A12FF, 0x665620FF, 0xC2980AFF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDAAA04FF, 0xDBAA03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03CC, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0xDDAC0357, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDAAA04FF, 0xDCAB03FF, 0xDCAB03FF, 0xDAAA04FF, 0xDBAA03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03CC, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xDDAC0357, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDAAA04FF, 0xDBAA03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03CC, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0xDDAC0357, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03CC, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0xDDAC0357, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03CC, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xDDAC0357, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03CC, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0xDDAC0357, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03CC, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0xDDAC0357, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03CC, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xDDAC0357, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03CC, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0xDDAC0357, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDDAC03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03CC, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0xDDAC0357, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDDAC04FF, 0xDDAC04FF, 0xDDAC03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03CC, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xDDAC0357, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDDAC03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03CC, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0xDDAC0357, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03CC, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0xDDAC0357, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03CC, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xDDAC0357, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03CC, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0xDDAC0357, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03CC, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0xDDAC0357, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03CC, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xDDAC0357, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03CC, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0xDDAC0357, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03CC, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0xDDAC0357, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDDAC03FF, 0xDDAC04FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03CC, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xDDAC0357, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDDAC04FF, 0xDFAE05FF, 0xDFAE05FF,
+  0xDDAC04FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03CC, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0xDDAC035D, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDEAD04FF, 0xE0AF06FF, 0xE2B108FF, 0xE0AF06FF, 0xDDAC03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03DB, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xE6B30301,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0,
+};
+constexpr EmbeddedIcon null2container = { 64, 64, null2container_pixels };
+
+static constexpr UInt32 container2null_pixels[4096] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0xFFDC5D0A, 0xFFDB5D72, 0xFFDB5D6B,
+  0xFFDB5D6B, 0xFFDB5D6B, 0xFFDB5D6B, 0xFFDB5D6B, 0xFFDB5D6B, 0xFFDB5D6B, 0xFFDB5D6B, 0xFFDB5D6B, 0xFEDB5D6B, 0xFFDB5D70, 0xFFDB5D76, 0xFFDB5D76,
+  0xFFDB5D76, 0xFFDD5E59, 0xFFDB5D01, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0xFFDC5DA0, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF,
+  0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDC5DF4, 0xFFDC5D29, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0xFFE05F2A, 0xFFDC5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF,
+  0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDC5D8C, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0xFFE9630B, 0xFFDC5DC1, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF,
+  0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF,
+  0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFE05F17, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xFFDB5D24,
+  0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF,
+  0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDC5DFF, 0xFFDB5DBE, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0xFFDB5DDC, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF,
+  0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDB5DFF, 0xFFDC5DFB,
+  0xFFDC5D40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0xE6B30301, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0xEBC12A86, 0xDFB00CFB, 0xE0B10FFF, 0xE0B10FFF, 0xE0B10FFF, 0xE0B10FFF, 0xE0B10FFF,
+  0xE0B10FFF, 0xE0B10FFF, 0xE0B10FFF, 0xE0B10FFF, 0xE0B10FFF, 0xE0B10FFF, 0xE0B10FFF, 0xE0B10FFF, 0xE0B10FFF, 0xE0B10FFF, 0xE0B10FFF, 0xE0B10FFF,
+  0xE0B10FFF, 0xE0B10EFE, 0xE0B10FFF, 0xE0B10EFE, 0xDCAC05E2, 0xDCAB03DD, 0xDCAB03DD, 0xDCAB03DD, 0xDCAB03DD, 0xDCAB03DD, 0xDCAB03DD, 0xDCAB03DD,
+  0xDCAB03DD, 0xDCAB03DD, 0xDCAB03DD, 0xDCAB03DD, 0xDCAB03DD, 0xDCAB03DD, 0xDCAB03DD, 0xDCAB03DD, 0xDCAB03DD, 0xDCAB03B0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0xEABF2690, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03CC, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0xEBBF2894, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03CC, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0xDDAC0357, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03CC, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0xDDAC0357, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03CC, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0xDDAC0357, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03CC, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0xDDAC0357, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03CC, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0xDDAC0357, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03CC, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0xDDAC0357, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03CC, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0xDDAC0357, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03CC, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0xDDAC0357, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03CC, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0xDDAC0357, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03CC, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0xDDAC0357, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03CC, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0xDDAC0357, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDDAC03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03CC, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0xDDAC0357, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDDAC04FF, 0xDDAC04FF, 0xDDAC03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03CC, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0xDDAC0357, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDDAC03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03CC, 0, 0x80808010,
+  0x37373760, 0x32323290, 0x323232A0, 0x37373770, 0x80808010, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0xDDAC0357, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDBAA03FF, 0xDCAB03FF, 0x8A701AFF, 0xCFA410FF, 0xDCAB03FF, 0xDBAA03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03CC, 0x37373767, 0x373839FF, 0x687180FF, 0x8291A6FF, 0x8B9BB3FF, 0x707C8DFF, 0x373839FF, 0x32323287, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0xDDAC0357, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDAAA04FF, 0xDCAB03FF, 0xC69C0FFF, 0x393939FF, 0x8D731CFF, 0xDCAB03FF, 0xDAAA04FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xB49013D7, 0x373839FF, 0xA5BBD9FF, 0xBFD9FFFF, 0xBFD9FFFF, 0xBFD9FFFF, 0xBFD9FFFF,
+  0xB7CFF3FF, 0x474D53FF, 0x37373757, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0xDDAC0357, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDAAA04FF, 0xDCAB03FF, 0x725F1DFF, 0xB6B5B6FF,
+  0x66614BFF, 0xD5A80BFF, 0xDCAB03FF, 0xDBAA03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0x685822EC, 0x8B9BB3FF, 0xBFD9FFFF,
+  0xBFD9FFFF, 0xBFD9FFFF, 0xB7CFF3FF, 0xBFD9FFFF, 0xBFD9FFFF, 0x9CB0CDFF, 0x323232C0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0xDDAC0357, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDBAA03FF,
+  0xDCAB03FF, 0xC0970AFF, 0x62615FFF, 0xF7F7F6FF, 0xA2A2A2FF, 0x896F16FF, 0xDCAB03FF, 0xDAAA04FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xD6A80AFF, 0x373839FF, 0xBFD9FFFF, 0xBFD9FFFF, 0xBFD9FFFF, 0x3D3F45FF, 0x373839FF, 0xB7CFF3FF, 0xBFD9FFFF, 0xBFD9FFFF, 0x474D53FF, 0x43434330,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0xDDAC0357, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDAAA04FF, 0xDCAB03FF, 0x75601DFF, 0xBBBBBAFF, 0xF0EEECFF, 0xDFE0DFFF, 0x595244FF, 0xD5A80BFF, 0xDCAB03FF,
+  0xDBAA03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xB28D10FF, 0x515862FF, 0xBFD9FFFF, 0xBFD9FFFF, 0x9CB0CDFF, 0x323232C0, 0x32323290, 0x8291A6FF,
+  0xBFD9FFFF, 0xBFD9FFFF, 0x707C8DFF, 0x37373770, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0xDDAC0357, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDAAA04FF, 0xDCAB03FF, 0xC79D0BFF, 0x6C6B64FF, 0xECECEDFF, 0xDFE0E0FF,
+  0xF1F0EFFF, 0xA6A6A5FF, 0x8F7314FF, 0xDCAB03FF, 0xDAAA05FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0x866E1AFF, 0x798799FF, 0xBFD9FFFF, 0xBFD9FFFF,
+  0x798799FF, 0x32323280, 0x32323280, 0x798799FF, 0xBFD9FFFF, 0xBFD9FFFF, 0x798799FF, 0x32323280, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0xDDAC0357, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDBAA03FF, 0xDCAB03FF,
+  0x6D5B1FFF, 0xB4B3B4FF, 0xE8E9E4FF, 0xE3E2E3FF, 0xE3E5E1FF, 0xD8D7D8FF, 0x535043FF, 0xD4A70CFF, 0xDCAB03FF, 0xDBAA03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0x866E1AFF, 0x798799FF, 0xBFD9FFFF, 0xBFD9FFFF, 0x798799FF, 0x32323280, 0x37373750, 0x5C6471FF, 0xBFD9FFFF, 0xBFD9FFFF, 0x9CB0CDFF, 0x323232C0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0xDDAC0357, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDDAC03FF, 0xDDAC04FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDBAA03FF, 0xDCAB03FF, 0xD3A60EFF, 0x625428FF, 0x534C33FF, 0x959595FF, 0xF2F3F2FF, 0xC7C7C8FF, 0x595743FF, 0x544C2EFF, 0xA78611FF,
+  0xDCAB03FF, 0xDBAA03FF, 0xDCAB03FF, 0xDCAB03FF, 0x866E1AFF, 0x798799FF, 0xBFD9FFFF, 0xBFD9FFFF, 0x798799FF, 0x32323280, 0x37373740, 0x515862FF,
+  0xBFD9FFFF, 0xBFD9FFFF, 0x9CB0CDFF, 0x323232C0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0xDDAC0357, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDDAC04FF, 0xDFAE05FF, 0xDFAE05FF, 0xDDAC04FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xD9A905FF, 0xDCAB03FF, 0xB18C0BFF, 0x888988FF, 0xF9F7F4FF,
+  0xC5C5C5FF, 0x7B651BFF, 0xDCAB03FF, 0xDAAA05FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0x866E1AFF, 0x798799FF, 0xBFD9FFFF, 0xBFD9FFFF,
+  0x798799FF, 0x32323280, 0x37373750, 0x5C6471FF, 0xBFD9FFFF, 0xBFD9FFFF, 0x9CB0CDFF, 0x323232C0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0xDDAC035D, 0xDCAB03FF, 0xDCAB03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDEAD04FF, 0xE0AF06FF, 0xE2B108FF, 0xE0AF06FF, 0xDDAC03FF,
+  0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDBAA03FF,
+  0xDCAB03FF, 0xAF8A0CFF, 0x8C8C8CFF, 0xF8F8F3FF, 0xC6C6C6FF, 0x7E681FFF, 0xDCAB03FF, 0xDBAA03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF, 0xDCAB03FF,
+  0x866E1AFF, 0x798799FF, 0xBFD9FFFF, 0xBFD9FFFF, 0x798799FF, 0x32323280, 0x32323280, 0x798799FF, 0xBFD9FFFF, 0xBFD9FFFF, 0x798799FF, 0x32323280,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0x80808003, 0, 0x28282840, 0x8B8B8BFF, 0xFAF9FAF9, 0xC6C6C5FF, 0x34333490, 0, 0x80808003,
+  0, 0, 0, 0, 0x37373740, 0x515862FF, 0xBFD9FFFF, 0xBFD9FFFF, 0x9CB0CDFF, 0x323232C0, 0x32323290, 0x8291A6FF,
+  0xBFD9FFFF, 0xBFD9FFFF, 0x707C8DFF, 0x37373770, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0x80808003, 0, 0x2B2C2B3F, 0x8C8B8CFF, 0xF9FAF9F9,
+  0xC6C6C6FF, 0x3434348F, 0, 0x80808003, 0, 0, 0, 0, 0x80808010, 0x373839FF, 0xBFD9FFFF, 0xBFD9FFFF,
+  0xBFD9FFFF, 0x3D3F45FF, 0x373839FF, 0xB7CFF3FF, 0xBFD9FFFF, 0xBFD9FFFF, 0x474D53FF, 0x43434330, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x80808003,
+  0, 0x28282840, 0x8B8B8BFF, 0xFAF8F9F9, 0xC5C6C5FF, 0x3434348F, 0, 0x80808003, 0, 0, 0, 0,
+  0, 0x323232A0, 0x8B9BB3FF, 0xBFD9FFFF, 0xBFD9FFFF, 0xBFD9FFFF, 0xB7CFF3FF, 0xBFD9FFFF, 0xBFD9FFFF, 0x9CB0CDFF, 0x323232C0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0x80808003, 0, 0x28282840, 0x8C8B8CFF, 0xF9FAF9F9, 0xC6C6C6FF, 0x3434348F, 0, 0x80808003,
+  0, 0, 0, 0, 0, 0x43434337, 0x373839FF, 0xA5BBD9FF, 0xBFD9FFFF, 0xBFD9FFFF, 0xBFD9FFFF, 0xBFD9FFFF,
+  0xB7CFF3FF, 0x474D53FF, 0x37373757, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0x80808003, 0, 0x28282840, 0x8B8B8BFF, 0xFAF9FAF9,
+  0xC6C6C5FF, 0x34343490, 0, 0x80808003, 0, 0, 0, 0, 0, 0, 0x37373767, 0x373839FF,
+  0x707C8DFF, 0x94A6C0FF, 0x94A6C0FF, 0x707C8DFF, 0x373839FF, 0x32323287, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x80808003,
+  0, 0x2B2C2B3F, 0x8C8B8CFF, 0xF9FAF9F9, 0xC6C6C6FF, 0x3435358F, 0, 0x80808003, 0, 0, 0, 0,
+  0, 0, 0, 0x80808010, 0x37373770, 0x323232B0, 0x323232B0, 0x37373770, 0x80808010, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0x80808003, 0, 0x28282840, 0x8B8B8BFF, 0xFAF8FAF9, 0xC5C6C6FF, 0x34343490, 0, 0x80808003,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x80808002, 0x80808002,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0x80808003, 0, 0x28282840, 0x8C8B8CFF, 0xF9FAF9F9,
+  0xC6C6C6FF, 0x3434348F, 0, 0x80808003, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0x80808004, 0, 0, 0x80808004, 0x80808002, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x80808003,
+  0, 0x28282840, 0x8B8B8BFF, 0xFAF9FAF9, 0xC6C6C6FF, 0x35353591, 0, 0x80808006, 0x80808003, 0x80808003, 0x80808003, 0x80808003,
+  0x80808003, 0x80808003, 0x80808003, 0x80808006, 0, 0x3939394B, 0x2E2F2EAD, 0x38383825, 0, 0, 0x80808003, 0x80808002,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0x80808003, 0, 0x2B2C2B3F, 0x8C8B8CFF, 0xFAFAF9F9, 0xC5C5C5FF, 0x2F2F2F89, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0x28282847, 0x797879FF, 0x6E6F6EF5,
+  0x2D2D2D97, 0x38383825, 0, 0, 0x80808004, 0x80808001, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0x80808003, 0, 0x28282840, 0x8B8B8BFF, 0xF6F4F6FB,
+  0xC6C7C6FF, 0x474647E3, 0x464946BC, 0x4A484AC0, 0x494949BF, 0x49494BBF, 0x494B49BF, 0x4A484AC0, 0x494A49BF, 0x4A494BBF, 0x494B49BF, 0x4A484AC0,
+  0x4B4E4EBC, 0x3B3B3BD3, 0xA5A7A5FE, 0xF3F3F3FF, 0xBABABAFF, 0x616161F7, 0x2C2C2C95, 0x5656561F, 0, 0, 0x80808001, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x80808003,
+  0, 0x2B2C2B3F, 0x8F8E8FFF, 0xF7F8F7F9, 0xE7E6E6FC, 0xDEDFDEFF, 0xE0E0E0FF, 0xDFE0E0FF, 0xE0DFE0FF, 0xDEDEDEFF, 0xDEDEDEFF, 0xDEDEDEFF,
+  0xDEDEDEFF, 0xDEDEDEFF, 0xDEDEDEFF, 0xDEDEDEFF, 0xDFDEDEFF, 0xDDDDDDFF, 0xDFDFDFFF, 0xE3E4E4FE, 0xEDEDEDFC, 0xE8E8E8FF, 0xC0C0C0FF, 0x616262F6,
+  0x2F2F2F9E, 0x7D7D7D1C, 0, 0x80808001, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0x80808003, 0, 0x29292943, 0x878787FF, 0xDDDDDDFF, 0xD3D4D3FF, 0xD7D7D7FF, 0xD6D7D6FF, 0xD6D6D7FF,
+  0xD8D8D7FF, 0xDEDDDEFF, 0xDDDEDEFF, 0xDEDDDEFF, 0xDDDEDDFF, 0xDEDDDEFF, 0xDDDEDDFF, 0xDEDDDEFF, 0xDEDEDDFF, 0xDDDCDDFF, 0xDEE0E0FE, 0xE4E3E4FE,
+  0xECEEECFB, 0xEAE9EAFF, 0xC1C1C1FF, 0x606062F9, 0x2F2F2F9D, 0x7D7D7D1C, 0, 0x80808001, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0x80808002, 0, 0x3B403B30, 0x373737CA, 0x424342BD,
+  0x3F3F3FC0, 0x3F403FBF, 0x3F3D3FC0, 0x3F3F3FBF, 0x403F40C0, 0x494B49BF, 0x4A494AC0, 0x494B49BF, 0x4A484AC0, 0x494B49BF, 0x4A494AC0, 0x494A48C0,
+  0x4D4C4EBC, 0x3A3B3AD3, 0xA6A5A6FF, 0xF3F4F3FF, 0xBABABAFF, 0x636563F7, 0x2D2D2D97, 0x44444422, 0, 0, 0x80808001, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0x28282848, 0x777777FF, 0x6F6D6FF7, 0x2D2D2D97, 0x38383825, 0, 0,
+  0x80808003, 0x80808001, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0x80808004, 0x80808003, 0x80808004, 0x80808003, 0x80808003, 0x80808003,
+  0x80808004, 0x80808003, 0x80808003, 0x80808003, 0x80808004, 0x80808003, 0x80808003, 0x80808005, 0, 0x3A3C3A4A, 0x2F2F2FAD, 0x34343427,
+  0, 0, 0x80808004, 0x80808002, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0x80808004, 0, 0, 0x80808003, 0x80808002, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0x80808003, 0x80808002, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0,
+};
+constexpr EmbeddedIcon container2null = { 64, 64, container2null_pixels };
+
+} // namespace EmbeddedIcons
@@ -0,0 +1,15 @@
+/// Generated by tools/embed_icons.py from res/img. Do not edit.
+///
+/// \file Generated/EmbeddedIcons.h
+
+#pragma once
+
+#include "../Utils/EmbeddedIcon.h"
+
+namespace EmbeddedIcons {
+
+extern const EmbeddedIcon ocontainer; ///< res/img/ocontainer.png
+extern const EmbeddedIcon null2container; ///< res/img/null2container.png
+extern const EmbeddedIcon container2null; ///< res/img/container2null.png
+
+} // namespace EmbeddedIcons
@@ -0,0 +1,72 @@
+/// Copyright (C) 2013-2015, Niklas Rosenstein
+/// All rights reserved.
+///
+/// Licensed under the GNU Lesser General Public License.
+///
+/// \file LodTag.cpp
+///
+/// The "Container LOD" tag marks a direct child of a Container as a
+/// level of detail. The tag itself does nothing, the Container reads its
+/// thresholds and picks the active level (see ContentSyncMessage).
+
+#include <c4d.h>
+#include <c4d_apibridge.h>
+#include <Tcontainerlod.h>
+#include "res/c4d_symbols.h"
+#include "Generated/EmbeddedIcons.h"
+
+/// ***************************************************************************
+/// ***************************************************************************
+class ContainerLodTag : public TagData
+{
+  typedef TagData super;
+
+public:
+
+  static NodeData* Alloc() { return gNew(ContainerLodTag); }
+
+  //  NodeData Overrides
+
+  virtual Bool Init(GeListNode* node) override
+  {
+    if (!node || !super::Init(node)) return false;
+    BaseContainer* bc = ((BaseList2D*) node)->GetDataInstance();
+    if (!bc) return false;
+    bc->SetInt32(CONTAINERLOD_MODE, CONTAINERLOD_MODE_DISTANCE);
+    bc->SetFloat(CONTAINERLOD_DISTANCE, 1000.0);
+    bc->SetFloat(CONTAINERLOD_SCREENSIZE, 100.0);
+    return true;
+  }
+
+  virtual Bool GetDEnabling(GeListNode* node, const DescID& id,
+        const GeData& t_data, DESCFLAGS_ENABLE flags,
+        const BaseContainer* itemdesc) override
+  {
+    BaseContainer* bc = ((BaseList2D*) node)->GetDataInstance();
+    switch (id[0].id) {
+      case CONTAINERLOD_DISTANCE:
+        return bc && bc->GetInt32(CONTAINERLOD_MODE) == CONTAINERLOD_MODE_DISTANCE;
+      case CONTAINERLOD_SCREENSIZE:
+        return bc && bc->GetInt32(CONTAINERLOD_MODE) == CONTAINERLOD_MODE_SCREENSIZE;
+    }
+    return super::GetDEnabling(node, id, t_data, flags, itemdesc);
+  }
+
+};
+
+/// ***************************************************************************
+/// ***************************************************************************
+Bool RegisterContainerLodTag()
+{
+  AutoAlloc<BaseBitmap> bmp;
+  InitEmbeddedIcon(bmp, EmbeddedIcons::ocontainer);
+
+  return RegisterTagPlugin(
+    Tcontainerlod,
+    GeLoadString(IDS_TCONTAINERLOD),
+    TAG_VISIBLE,
+    ContainerLodTag::Alloc,
+    "Tcontainerlod"_s,
+    bmp,
+    0);
+}
@@ -48,6 +48,11 @@ class AABB
     detailed_measuring = detailed;
   }
 
+  /// Returns true if at least one point has been added to the AABB.
+  inline Bool IsInitialized() const {
+    return is_init;
+  }
+
   /// Obtain the results by storing it into the passed references.
   inline void GetResult(Vector& bbmin, Vector& bbmax) const {
     bbmin = mm.GetMax();
@@ -0,0 +1,33 @@
+/// Copyright (C) 2013-2015, Niklas Rosenstein
+/// All rights reserved.
+///
+/// Licensed under the GNU Lesser General Public License.
+///
+/// \file Utils/Compression.cpp
+
+#include "Compression.h"
+
+#include "maxon/streamconversion.h"
+#include "maxon/streamconversion_zip.h"
+
+/// ***************************************************************************
+/// ***************************************************************************
+maxon::Result<void> Compress(const maxon::Block<const maxon::Char>& src,
+    maxon::BaseArray<maxon::Char>& dst)
+{
+  iferr_scope;
+  const maxon::StreamConversionRef encoder = maxon::StreamConversions::ZipEncoder().Create() iferr_return;
+  encoder.ConvertAll(src, dst) iferr_return;
+  return maxon::OK;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+maxon::Result<void> Decompress(const maxon::Block<const maxon::Char>& src,
+    maxon::BaseArray<maxon::Char>& dst)
+{
+  iferr_scope;
+  const maxon::StreamConversionRef decoder = maxon::StreamConversions::ZipDecoder().Create() iferr_return;
+  decoder.ConvertAll(src, dst) iferr_return;
+  return maxon::OK;
+}
@@ -0,0 +1,23 @@
+/// Copyright (C) 2013-2015, Niklas Rosenstein
+/// All rights reserved.
+///
+/// Licensed under the GNU Lesser General Public License.
+///
+/// \file Utils/Compression.h
+
+#pragma once
+
+#include <c4d.h>
+#include "maxon/basearray.h"
+
+/// ***************************************************************************
+/// Compresses *src* with the Zip stream conversion into *dst*.
+/// ***************************************************************************
+maxon::Result<void> Compress(const maxon::Block<const maxon::Char>& src,
+    maxon::BaseArray<maxon::Char>& dst);
+
+/// ***************************************************************************
+/// Decompresses data written by #Compress() into *dst*.
+/// ***************************************************************************
+maxon::Result<void> Decompress(const maxon::Block<const maxon::Char>& src,
+    maxon::BaseArray<maxon::Char>& dst);
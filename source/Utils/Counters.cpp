@@ -0,0 +1,82 @@
+/// Copyright (C) 2013-2015, Niklas Rosenstein
+/// All rights reserved.
+///
+/// Licensed under the GNU Lesser General Public License.
+///
+/// \file Utils/Counters.cpp
+
+#include "Counters.h"
+
+/// Head of the singly linked list of all shards. Shards are never
+/// freed, so the totals of finished threads are kept.
+static std::atomic<PerfCounterShard*> g_shards(nullptr);
+
+/// ***************************************************************************
+/// ***************************************************************************
+PerfCounterShard* AllocPerfCounterShard()
+{
+  PerfCounterShard* shard = gNew(PerfCounterShard);
+  if (!shard) return nullptr;
+  for (LONG i = 0; i < PERFCOUNTER_COUNT; ++i)
+    shard->values[i].store(0, std::memory_order_relaxed);
+
+  PerfCounterShard* head = g_shards.load(std::memory_order_relaxed);
+  do {
+    shard->next = head;
+  } while (!g_shards.compare_exchange_weak(head, shard,
+      std::memory_order_release, std::memory_order_relaxed));
+  return shard;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+Int64 GlobalCounterGet(PERFCOUNTER counter)
+{
+  Int64 total = 0;
+  PerfCounterShard* shard = g_shards.load(std::memory_order_acquire);
+  for (; shard; shard = shard->next)
+    total += shard->values[counter].load(std::memory_order_relaxed);
+  return total;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+static String FormatMillis(Int64 micros)
+{
+  return RealToString(micros / 1000.0, -1, 2) + " ms";
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+static String FormatBytes(Int64 bytes)
+{
+  if (bytes >= 1024 * 1024)
+    return RealToString(bytes / (1024.0 * 1024.0), -1, 1) + " MB";
+  if (bytes >= 1024)
+    return RealToString(bytes / 1024.0, -1, 1) + " KB";
+  return String::IntToString(bytes) + " B";
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+String FormatCounters(const PerfCounters& local, Int64 localIconBytes)
+{
+  String str;
+  str += "GetDimension " + String::IntToString(local.Get(PERFCOUNTER_DIMENSION_CALLS));
+  str += "x / " + FormatMillis(local.Get(PERFCOUNTER_DIMENSION_MICROS));
+  str += ", visited " + String::IntToString(local.Get(PERFCOUNTER_NODES_VISITED));
+  str += ", flipped " + String::IntToString(local.Get(PERFCOUNTER_NODES_FLIPPED));
+  str += ", icon copies " + String::IntToString(local.Get(PERFCOUNTER_ICON_COPIES));
+  str += ", icon " + FormatBytes(localIconBytes);
+  str += "  |  Global: GetDimension " + String::IntToString(GlobalCounterGet(PERFCOUNTER_DIMENSION_CALLS));
+  str += "x / " + FormatMillis(GlobalCounterGet(PERFCOUNTER_DIMENSION_MICROS));
+  str += ", visited " + String::IntToString(GlobalCounterGet(PERFCOUNTER_NODES_VISITED));
+  str += ", flipped " + String::IntToString(GlobalCounterGet(PERFCOUNTER_NODES_FLIPPED));
+  str += ", icon copies " + String::IntToString(GlobalCounterGet(PERFCOUNTER_ICON_COPIES));
+  #ifdef NRCONTAINER_BENCHMARK
+    str += ", GetInfo " + String::IntToString(GlobalCounterGet(PERFCOUNTER_GETINFO_CALLS));
+  #endif
+  str += ", icons " + FormatBytes(GlobalCounterGet(PERFCOUNTER_ICON_BYTES));
+  str += ", startup " + FormatMillis(GlobalCounterGet(PERFCOUNTER_STARTUP_MICROS));
+  return str;
+}
@@ -0,0 +1,103 @@
+/// Copyright (C) 2013-2015, Niklas Rosenstein
+/// All rights reserved.
+///
+/// Licensed under the GNU Lesser General Public License.
+///
+/// \file Utils/Counters.h
+
+#pragma once
+
+#include <atomic>
+#include <c4d.h>
+#include <c4d_legacy.h>
+
+/// ***************************************************************************
+/// Identifiers of the performance counters.
+/// ***************************************************************************
+enum PERFCOUNTER
+{
+  PERFCOUNTER_DIMENSION_CALLS,
+  PERFCOUNTER_DIMENSION_MICROS,
+  PERFCOUNTER_NODES_VISITED,
+  PERFCOUNTER_NODES_FLIPPED,
+  PERFCOUNTER_ICON_COPIES,
+  PERFCOUNTER_GETINFO_CALLS,  ///< Only counted with NRCONTAINER_BENCHMARK.
+  PERFCOUNTER_ICON_BYTES,
+  PERFCOUNTER_STARTUP_MICROS,  ///< Time spent in PluginStart(), global only.
+  PERFCOUNTER_COUNT,
+};
+
+/// ***************************************************************************
+/// A set of counters owned by a single object. Updates are relaxed
+/// atomics, they only need to be consistent enough to be displayed.
+/// ***************************************************************************
+class PerfCounters
+{
+  std::atomic<Int64> m_values[PERFCOUNTER_COUNT];
+
+public:
+
+  PerfCounters()
+  {
+    for (LONG i = 0; i < PERFCOUNTER_COUNT; ++i)
+      m_values[i].store(0, std::memory_order_relaxed);
+  }
+
+  inline void Add(PERFCOUNTER counter, Int64 value)
+  {
+    m_values[counter].fetch_add(value, std::memory_order_relaxed);
+  }
+
+  inline Int64 Get(PERFCOUNTER counter) const
+  {
+    return m_values[counter].load(std::memory_order_relaxed);
+  }
+};
+
+/// ***************************************************************************
+/// A block of counters written by exactly one thread. Each thread that
+/// updates a global counter gets its own shard, so the hot paths never
+/// contend on a shared cache line. Shards are summed up on read.
+/// ***************************************************************************
+struct PerfCounterShard
+{
+  std::atomic<Int64> values[PERFCOUNTER_COUNT];
+  PerfCounterShard* next;
+};
+
+/// Allocates and registers the shard of the calling thread.
+PerfCounterShard* AllocPerfCounterShard();
+
+/// ***************************************************************************
+/// Adds *value* to the global *counter* from the calling thread.
+/// ***************************************************************************
+inline void GlobalCounterAdd(PERFCOUNTER counter, Int64 value)
+{
+  static thread_local PerfCounterShard* shard = nullptr;
+  if (!shard)
+    shard = AllocPerfCounterShard();
+  if (!shard) return;
+  // Only this thread writes to the shard, no read-modify-write needed.
+  std::atomic<Int64>& v = shard->values[counter];
+  v.store(v.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+/// ***************************************************************************
+/// Returns the sum of the global *counter* over all threads.
+/// ***************************************************************************
+Int64 GlobalCounterGet(PERFCOUNTER counter);
+
+/// ***************************************************************************
+/// Adds *value* to both the *local* and the global *counter*.
+/// ***************************************************************************
+inline void CounterAdd(PerfCounters& local, PERFCOUNTER counter, Int64 value)
+{
+  local.Add(counter, value);
+  GlobalCounterAdd(counter, value);
+}
+
+/// ***************************************************************************
+/// Formats the *local* and global counters as a single line for display
+/// in the Attribute Manager.
+/// ***************************************************************************
+String FormatCounters(const PerfCounters& local, Int64 localIconBytes);
@@ -0,0 +1,315 @@
+/// Copyright (C) 2013-2015, Niklas Rosenstein
+/// All rights reserved.
+///
+/// Licensed under the GNU Lesser General Public License.
+///
+/// \file Utils/DynamicBVH.cpp
+
+#include "DynamicBVH.h"
+#include <algorithm>
+
+/// ***************************************************************************
+/// Leaves grow by this fraction of their size (at least the absolute
+/// amount) so that jitter doesn't change the tree.
+/// ***************************************************************************
+static const Float BVH_MARGIN_RELATIVE = 0.1;
+static const Float BVH_MARGIN_ABSOLUTE = 1.0;
+
+static Vector VMin(const Vector& a, const Vector& b)
+{
+  return Vector(Min(a.x, b.x), Min(a.y, b.y), Min(a.z, b.z));
+}
+
+static Vector VMax(const Vector& a, const Vector& b)
+{
+  return Vector(Max(a.x, b.x), Max(a.y, b.y), Max(a.z, b.z));
+}
+
+/// Half the surface area, the cost of a node in the insertion heuristic.
+static Float Area(const Vector& bbmin, const Vector& bbmax)
+{
+  const Vector d = bbmax - bbmin;
+  return d.x * d.y + d.y * d.z + d.z * d.x;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+void DynamicBVH::Clear()
+{
+  m_nodes.clear();
+  m_root = NOTOK;
+  m_free = NOTOK;
+  m_count = 0;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+LONG DynamicBVH::AllocateNode()
+{
+  LONG id = m_free;
+  if (id != NOTOK)
+    m_free = m_nodes[id].parent;
+  else
+  {
+    id = (LONG) m_nodes.size();
+    m_nodes.emplace_back();
+  }
+  Node& node = m_nodes[id];
+  node.data = nullptr;
+  node.parent = node.child1 = node.child2 = NOTOK;
+  node.height = 0;
+  return id;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+void DynamicBVH::FreeNode(LONG id)
+{
+  m_nodes[id].parent = m_free;
+  m_nodes[id].height = -1;
+  m_free = id;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+LONG DynamicBVH::Insert(const Vector& bbmin, const Vector& bbmax, void* data)
+{
+  const LONG id = AllocateNode();
+  Node& node = m_nodes[id];
+  const Vector margin = (bbmax - bbmin) * BVH_MARGIN_RELATIVE + Vector(BVH_MARGIN_ABSOLUTE);
+  node.tightMin = bbmin;
+  node.tightMax = bbmax;
+  node.bbmin = bbmin - margin;
+  node.bbmax = bbmax + margin;
+  node.data = data;
+  InsertLeaf(id);
+  ++m_count;
+  return id;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+void DynamicBVH::Remove(LONG proxy)
+{
+  RemoveLeaf(proxy);
+  FreeNode(proxy);
+  --m_count;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+Bool DynamicBVH::Update(LONG proxy, const Vector& bbmin, const Vector& bbmax)
+{
+  Node& node = m_nodes[proxy];
+  node.tightMin = bbmin;
+  node.tightMax = bbmax;
+  if (node.bbmin.x <= bbmin.x && node.bbmin.y <= bbmin.y && node.bbmin.z <= bbmin.z
+      && node.bbmax.x >= bbmax.x && node.bbmax.y >= bbmax.y && node.bbmax.z >= bbmax.z)
+    return false;
+
+  RemoveLeaf(proxy);
+  const Vector margin = (bbmax - bbmin) * BVH_MARGIN_RELATIVE + Vector(BVH_MARGIN_ABSOLUTE);
+  m_nodes[proxy].bbmin = bbmin - margin;
+  m_nodes[proxy].bbmax = bbmax + margin;
+  InsertLeaf(proxy);
+  return true;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+void DynamicBVH::Refit(LONG id)
+{
+  Node& node = m_nodes[id];
+  const Node& c1 = m_nodes[node.child1];
+  const Node& c2 = m_nodes[node.child2];
+  node.bbmin = VMin(c1.bbmin, c2.bbmin);
+  node.bbmax = VMax(c1.bbmax, c2.bbmax);
+  node.height = 1 + std::max(c1.height, c2.height);
+}
+
+/// ***************************************************************************
+/// Finds the sibling with the lowest increase in surface area, joins it
+/// with the leaf under a new parent and refits the ancestors.
+/// ***************************************************************************
+void DynamicBVH::InsertLeaf(LONG leaf)
+{
+  if (m_root == NOTOK)
+  {
+    m_root = leaf;
+    m_nodes[leaf].parent = NOTOK;
+    return;
+  }
+
+  const Vector lmin = m_nodes[leaf].bbmin;
+  const Vector lmax = m_nodes[leaf].bbmax;
+  LONG index = m_root;
+  while (!m_nodes[index].IsLeaf())
+  {
+    const Node& node = m_nodes[index];
+    const Float area = Area(node.bbmin, node.bbmax);
+    const Float combined = Area(VMin(node.bbmin, lmin), VMax(node.bbmax, lmax));
+    const Float cost = 2.0 * combined;
+    const Float inherited = 2.0 * (combined - area);
+
+    Float childCost[2];
+    const LONG children[2] = {node.child1, node.child2};
+    for (LONG i = 0; i < 2; ++i)
+    {
+      const Node& child = m_nodes[children[i]];
+      const Float merged = Area(VMin(child.bbmin, lmin), VMax(child.bbmax, lmax));
+      childCost[i] = child.IsLeaf() ? merged + inherited
+        : merged - Area(child.bbmin, child.bbmax) + inherited;
+    }
+    if (cost < childCost[0] && cost < childCost[1]) break;
+    index = childCost[0] < childCost[1] ? children[0] : children[1];
+  }
+
+  const LONG sibling = index;
+  const LONG oldParent = m_nodes[sibling].parent;
+  const LONG newParent = AllocateNode();
+  m_nodes[newParent].parent = oldParent;
+  m_nodes[newParent].child1 = sibling;
+  m_nodes[newParent].child2 = leaf;
+  m_nodes[sibling].parent = newParent;
+  m_nodes[leaf].parent = newParent;
+  if (oldParent == NOTOK)
+    m_root = newParent;
+  else if (m_nodes[oldParent].child1 == sibling)
+    m_nodes[oldParent].child1 = newParent;
+  else
+    m_nodes[oldParent].child2 = newParent;
+
+  for (index = newParent; index != NOTOK; index = m_nodes[index].parent)
+  {
+    index = Balance(index);
+    Refit(index);
+  }
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+void DynamicBVH::RemoveLeaf(LONG leaf)
+{
+  if (leaf == m_root)
+  {
+    m_root = NOTOK;
+    return;
+  }
+
+  const LONG parent = m_nodes[leaf].parent;
+  const LONG grandParent = m_nodes[parent].parent;
+  const LONG sibling = m_nodes[parent].child1 == leaf ? m_nodes[parent].child2 : m_nodes[parent].child1;
+  if (grandParent == NOTOK)
+  {
+    m_root = sibling;
+    m_nodes[sibling].parent = NOTOK;
+    FreeNode(parent);
+    return;
+  }
+
+  if (m_nodes[grandParent].child1 == parent)
+    m_nodes[grandParent].child1 = sibling;
+  else
+    m_nodes[grandParent].child2 = sibling;
+  m_nodes[sibling].parent = grandParent;
+  FreeNode(parent);
+
+  for (LONG index = grandParent; index != NOTOK; index = m_nodes[index].parent)
+  {
+    index = Balance(index);
+    Refit(index);
+  }
+}
+
+/// ***************************************************************************
+/// Rotates the taller grandchild of *a* up if its children differ in
+/// height by more than one. Returns the node that is now at the place
+/// of *a*.
+/// ***************************************************************************
+LONG DynamicBVH::Balance(LONG a)
+{
+  Node& A = m_nodes[a];
+  if (A.IsLeaf() || A.height < 2) return a;
+
+  const LONG b = A.child1;
+  const LONG c = A.child2;
+  const LONG balance = m_nodes[c].height - m_nodes[b].height;
+  if (balance >= -1 && balance <= 1) return a;
+
+  // Rotate the taller child (up) into the place of *a*.
+  const LONG up = balance > 1 ? c : b;
+  Node& U = m_nodes[up];
+  const LONG f = U.child1;
+  const LONG g = U.child2;
+
+  U.child1 = a;
+  U.parent = A.parent;
+  A.parent = up;
+  if (U.parent == NOTOK)
+    m_root = up;
+  else if (m_nodes[U.parent].child1 == a)
+    m_nodes[U.parent].child1 = up;
+  else
+    m_nodes[U.parent].child2 = up;
+
+  // The taller grandchild stays under *up*, the other one replaces *up*
+  // as a child of *a*.
+  const Bool keepF = m_nodes[f].height > m_nodes[g].height;
+  const LONG keep = keepF ? f : g;
+  const LONG move = keepF ? g : f;
+  U.child2 = keep;
+  if (balance > 1)
+    A.child2 = move;
+  else
+    A.child1 = move;
+  m_nodes[move].parent = a;
+
+  Refit(a);
+  Refit(up);
+  return up;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+Bool DynamicBVH::InsidePlanes(const Vector& bbmin, const Vector& bbmax,
+  const Vector* normals, const Float* offsets, LONG count)
+{
+  for (LONG i = 0; i < count; ++i)
+  {
+    // The corner furthest along the normal.
+    const Vector& n = normals[i];
+    const Vector p(n.x >= 0.0 ? bbmax.x : bbmin.x, n.y >= 0.0 ? bbmax.y : bbmin.y,
+      n.z >= 0.0 ? bbmax.z : bbmin.z);
+    if (Dot(n, p) + offsets[i] < 0.0) return false;
+  }
+  return true;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+Bool DynamicBVH::IntersectRay(const Vector& bbmin, const Vector& bbmax,
+  const Vector& origin, const Vector& dir, Float maxDist, Float* tmin)
+{
+  Float t0 = 0.0, t1 = maxDist;
+  const Float o[3] = {origin.x, origin.y, origin.z};
+  const Float d[3] = {dir.x, dir.y, dir.z};
+  const Float lo[3] = {bbmin.x, bbmin.y, bbmin.z};
+  const Float hi[3] = {bbmax.x, bbmax.y, bbmax.z};
+  for (LONG i = 0; i < 3; ++i)
+  {
+    if (d[i] == 0.0)
+    {
+      if (o[i] < lo[i] || o[i] > hi[i]) return false;
+      continue;
+    }
+    const Float inv = 1.0 / d[i];
+    Float ta = (lo[i] - o[i]) * inv;
+    Float tb = (hi[i] - o[i]) * inv;
+    if (ta > tb) std::swap(ta, tb);
+    t0 = Max(t0, ta);
+    t1 = Min(t1, tb);
+    if (t0 > t1) return false;
+  }
+  *tmin = t0;
+  return true;
+}
@@ -0,0 +1,155 @@
+/// Copyright (C) 2013-2015, Niklas Rosenstein
+/// All rights reserved.
+///
+/// Licensed under the GNU Lesser General Public License.
+///
+/// \file Utils/DynamicBVH.h
+
+#pragma once
+
+#include <c4d.h>
+#include <c4d_legacy.h>
+#include <vector>
+
+/// ***************************************************************************
+/// A bounding volume hierarchy of axis aligned boxes that supports
+/// inserting, moving and removing leaves without a rebuild. Leaves are
+/// stored with a margin so that small movements don't change the tree,
+/// and the tree is kept balanced with rotations on the way up after
+/// every insert and remove.
+/// ***************************************************************************
+class DynamicBVH
+{
+public:
+
+  DynamicBVH() : m_root(NOTOK), m_free(NOTOK), m_count(0) { }
+
+  /// Removes all leaves.
+  void Clear();
+
+  /// Inserts a leaf and returns its proxy id.
+  LONG Insert(const Vector& bbmin, const Vector& bbmax, void* data);
+
+  /// Removes the leaf *proxy*.
+  void Remove(LONG proxy);
+
+  /// Moves the leaf *proxy* to a new box. The tree is only changed if
+  /// the box left the margin of the leaf, in which case true is returned.
+  Bool Update(LONG proxy, const Vector& bbmin, const Vector& bbmax);
+
+  /// Returns the data and the exact box of the leaf *proxy*.
+  void* GetData(LONG proxy) const { return m_nodes[proxy].data; }
+  void GetBounds(LONG proxy, Vector* bbmin, Vector* bbmax) const
+  {
+    *bbmin = m_nodes[proxy].tightMin;
+    *bbmax = m_nodes[proxy].tightMax;
+  }
+
+  /// Returns the number of leaves and the height of the tree.
+  LONG GetCount() const { return m_count; }
+  LONG GetHeight() const { return m_root == NOTOK ? 0 : m_nodes[m_root].height; }
+
+  /// Calls *visit(proxy)* for every leaf whose box overlaps the box from
+  /// *bbmin* to *bbmax*.
+  template <typename Visit>
+  void QueryBox(const Vector& bbmin, const Vector& bbmax, Visit visit) const
+  {
+    Traverse(
+      [&](const Vector& lo, const Vector& hi) { return Overlaps(lo, hi, bbmin, bbmax); },
+      visit);
+  }
+
+  /// Calls *visit(proxy)* for every leaf whose box is at least partially
+  /// on the positive side of all *count* planes `dot(n, p) + d >= 0`.
+  template <typename Visit>
+  void QueryPlanes(const Vector* normals, const Float* offsets, LONG count, Visit visit) const
+  {
+    Traverse(
+      [&](const Vector& lo, const Vector& hi) { return InsidePlanes(lo, hi, normals, offsets, count); },
+      visit);
+  }
+
+  /// Calls *visit(proxy)* for every leaf whose box is hit by the ray
+  /// from *origin* along *dir* within *maxDist*.
+  template <typename Visit>
+  void QueryRay(const Vector& origin, const Vector& dir, Float maxDist, Visit visit) const
+  {
+    Float tmin;
+    Traverse(
+      [&](const Vector& lo, const Vector& hi) { return IntersectRay(lo, hi, origin, dir, maxDist, &tmin); },
+      visit);
+  }
+
+  static Bool Overlaps(const Vector& amin, const Vector& amax, const Vector& bmin, const Vector& bmax)
+  {
+    return amin.x <= bmax.x && amax.x >= bmin.x && amin.y <= bmax.y && amax.y >= bmin.y
+      && amin.z <= bmax.z && amax.z >= bmin.z;
+  }
+
+  static Bool InsidePlanes(const Vector& bbmin, const Vector& bbmax,
+    const Vector* normals, const Float* offsets, LONG count);
+
+  /// Returns true and the distance of the entry point in *tmin* if the
+  /// ray hits the box. A ray that starts inside the box has *tmin* 0.
+  static Bool IntersectRay(const Vector& bbmin, const Vector& bbmax,
+    const Vector& origin, const Vector& dir, Float maxDist, Float* tmin);
+
+private:
+
+  struct Node
+  {
+    Vector bbmin;     ///< Including the margin for leaves.
+    Vector bbmax;
+    Vector tightMin;  ///< Leaves only, the box that was passed in.
+    Vector tightMax;
+    void* data;
+    LONG parent;      ///< Next free node while in the free list.
+    LONG child1;
+    LONG child2;
+    LONG height;      ///< 0 for leaves, -1 for free nodes.
+    Bool IsLeaf() const { return child1 == NOTOK; }
+  };
+
+  /// Visits the leaves whose (fat) box passes *test*. The leaf's exact
+  /// box is checked again before *visit* is called. *visit* returns
+  /// false to stop the traversal.
+  template <typename Test, typename Visit>
+  void Traverse(Test test, Visit visit) const
+  {
+    if (m_root == NOTOK) return;
+    LONG stack[64];
+    std::vector<LONG> overflow;
+    LONG top = 0;
+    stack[top++] = m_root;
+    while (top > 0 || !overflow.empty())
+    {
+      LONG id;
+      if (!overflow.empty()) { id = overflow.back(); overflow.pop_back(); }
+      else id = stack[--top];
+      const Node& node = m_nodes[id];
+      if (!test(node.bbmin, node.bbmax)) continue;
+      if (node.IsLeaf())
+      {
+        if (test(node.tightMin, node.tightMax) && !visit(id)) return;
+        continue;
+      }
+      for (LONG child : {node.child1, node.child2})
+      {
+        if (top < 64) stack[top++] = child;
+        else overflow.push_back(child);
+      }
+    }
+  }
+
+  LONG AllocateNode();
+  void FreeNode(LONG id);
+  void InsertLeaf(LONG leaf);
+  void RemoveLeaf(LONG leaf);
+  LONG Balance(LONG a);
+  void Refit(LONG id);
+
+  std::vector<Node> m_nodes;
+  LONG m_root;
+  LONG m_free;
+  LONG m_count;
+};
@@ -0,0 +1,34 @@
+/// Copyright (C) 2013-2015, Niklas Rosenstein
+/// All rights reserved.
+///
+/// Licensed under the GNU Lesser General Public License.
+///
+/// \file Utils/EmbeddedIcon.cpp
+
+#include "EmbeddedIcon.h"
+#include <vector>
+
+/// ***************************************************************************
+/// ***************************************************************************
+Bool InitEmbeddedIcon(BaseBitmap* bmp, const EmbeddedIcon& icon)
+{
+  if (!bmp || bmp->Init(icon.width, icon.height, 32) != IMAGERESULT_OK)
+    return false;
+  BaseBitmap* alpha = bmp->AddChannel(true, false);
+
+  std::vector<UChar> line(icon.width * 3);
+  for (LONG y = 0; y < icon.height; ++y)
+  {
+    UInt32 const* row = icon.pixels + y * icon.width;
+    for (LONG x = 0; x < icon.width; ++x)
+    {
+      line[x * 3 + 0] = (UChar) (row[x] >> 24);
+      line[x * 3 + 1] = (UChar) (row[x] >> 16);
+      line[x * 3 + 2] = (UChar) (row[x] >> 8);
+      if (alpha)
+        bmp->SetAlphaPixel(alpha, x, y, (UChar) row[x]);
+    }
+    bmp->SetPixelCnt(0, y, icon.width, line.data(), COLORBYTES_RGB, COLORMODE_RGB, PIXELCNT_0);
+  }
+  return true;
+}
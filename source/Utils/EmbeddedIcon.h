@@ -0,0 +1,27 @@
+/// Copyright (C) 2013-2015, Niklas Rosenstein
+/// All rights reserved.
+///
+/// Licensed under the GNU Lesser General Public License.
+///
+/// \file Utils/EmbeddedIcon.h
+
+#pragma once
+
+#include <c4d.h>
+#include <c4d_legacy.h>
+
+/// ***************************************************************************
+/// An icon compiled into the plugin binary. Pixels are stored row by row
+/// as 0xRRGGBBAA. The arrays are generated by tools/embed_icons.py.
+/// ***************************************************************************
+struct EmbeddedIcon
+{
+  LONG width;
+  LONG height;
+  UInt32 const* pixels;
+};
+
+/// ***************************************************************************
+/// Initializes *bmp* with the pixels of *icon*, including an alpha channel.
+/// ***************************************************************************
+Bool InitEmbeddedIcon(BaseBitmap* bmp, const EmbeddedIcon& icon);
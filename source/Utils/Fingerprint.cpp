@@ -0,0 +1,495 @@
+/// Copyright (C) 2013-2015, Niklas Rosenstein
+/// All rights reserved.
+///
+/// Licensed under the GNU Lesser General Public License.
+///
+/// \file Utils/Fingerprint.cpp
+
+#include "Fingerprint.h"
+#include "Misc.h"
+#include "Suspend.h"
+#include "Trace.h"
+#include <customgui_inexclude.h>
+#include <lib_ca.h>
+#include <texpression.h>
+#include <limits>
+#include <vector>
+
+enum
+{
+  /// Identifies the in-memory HyperFiles that custom data is hashed
+  /// from, they are never read back.
+  FINGERPRINT_HYPERFILE_IDENT = 'fprt',
+};
+
+/// ***************************************************************************
+/// ***************************************************************************
+String Fingerprint::ToString() const
+{
+  static const char digits[] = "0123456789abcdef";
+  char hex[65];
+  for (LONG i = 0; i < 32; ++i)
+  {
+    hex[i * 2] = digits[bytes[i] >> 4];
+    hex[i * 2 + 1] = digits[bytes[i] & 0xf];
+  }
+  hex[64] = 0;
+  return String(hex);
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+template <typename T>
+static void HashValue(SHA256& sha, const T& value)
+{
+  sha.add(&value, sizeof(T));
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+static void HashText(SHA256& sha, const String& str)
+{
+  Char* utf8 = str.GetCStringCopy(STRINGENCODING_UTF8);
+  const Int32 len = utf8 ? (Int32) std::strlen(utf8) : 0;
+  HashValue(sha, len);
+  if (utf8)
+  {
+    sha.add(utf8, len);
+    DeleteMem(utf8);
+  }
+}
+
+/// ***************************************************************************
+/// Returns true for the parameters that are changed by suspending a node.
+/// They are hashed separately by HashExecutionState().
+/// ***************************************************************************
+static Bool IsExecutionParameter(LONG id)
+{
+  switch (id)
+  {
+    case CONTAINEROBJECT_SUSPENDSTATE:
+    case ID_BASEOBJECT_VISIBILITY_EDITOR:
+    case ID_BASEOBJECT_VISIBILITY_RENDER:
+    case ID_BASEOBJECT_GENERATOR_FLAG:
+    case EXPRESSION_ENABLE:
+      return true;
+  }
+  return false;
+}
+
+/// ***************************************************************************
+/// Hashes the execution state of *node* as it was before it was
+/// suspended, so that suspending or freezing a hierarchy does not change
+/// its fingerprint.
+/// ***************************************************************************
+static void HashExecutionState(SHA256& sha, BaseList2D* node)
+{
+  const BaseContainer* bc = node->GetDataInstance();
+  const BaseContainer* state = bc ? bc->GetContainerInstance(CONTAINEROBJECT_SUSPENDSTATE) : nullptr;
+  if (node->IsInstanceOf(Obase))
+  {
+    BaseObject* op = static_cast<BaseObject*>(node);
+    HashValue(sha, state ? state->GetInt32(SUSPENDSTATE_EDITORMODE) : op->GetEditorMode());
+    HashValue(sha, state ? state->GetInt32(SUSPENDSTATE_RENDERMODE) : op->GetRenderMode());
+    HashValue(sha, (LONG) (state ? state->GetBool(SUSPENDSTATE_DEFORMMODE) : op->GetDeformMode()));
+  }
+  else if (static_cast<BaseTag*>(node)->GetInfo() & TAG_EXPRESSION)
+  {
+    const Bool enabled = state ? state->GetBool(SUSPENDSTATE_EXPRESSION)
+      : (bc && bc->GetBool(EXPRESSION_ENABLE));
+    HashValue(sha, (LONG) enabled);
+  }
+}
+
+/// ***************************************************************************
+/// State shared by the hash functions of a single node.
+/// ***************************************************************************
+struct HashContext
+{
+  BaseDocument* doc;
+  BaseObject* root;  ///< Links below it are hashed by their path from it.
+  Bool linked;       ///< Set when a link to an object, tag or material was hashed.
+};
+
+/// ***************************************************************************
+/// Returns the index of *node* among its siblings.
+/// ***************************************************************************
+static LONG GetSiblingIndex(GeListNode* node)
+{
+  LONG index = 0;
+  for (GeListNode* pred = node->GetPred(); pred; pred = pred->GetPred())
+    ++index;
+  return index;
+}
+
+/// ***************************************************************************
+/// Hashes the node a link points to. Objects and tags are identified by
+/// their path from the root of the fingerprint, so that links within
+/// equal hierarchies hash equally, or by their path in the document if
+/// they are outside of it. Materials are identified by their position
+/// in the document, other nodes by their type and name.
+/// ***************************************************************************
+static void HashLink(SHA256& sha, BaseList2D* link, HashContext& ctx)
+{
+  if (!link)
+  {
+    HashValue(sha, (LONG) NOTOK);
+    return;
+  }
+  HashValue(sha, (LONG) link->GetType());
+  HashText(sha, link->GetName());
+
+  BaseObject* host = nullptr;
+  LONG tagIndex = NOTOK;
+  if (link->IsInstanceOf(Tbase))
+  {
+    host = static_cast<BaseTag*>(link)->GetObject();
+    tagIndex = GetSiblingIndex(link);
+  }
+  else if (link->IsInstanceOf(Obase))
+    host = static_cast<BaseObject*>(link);
+  else if (link->IsInstanceOf(Mbase))
+  {
+    ctx.linked = true;
+    HashValue(sha, GetSiblingIndex(link));
+    return;
+  }
+  if (!host) return;
+
+  ctx.linked = true;
+  Bool inside = false;
+  std::vector<LONG> path;
+  for (BaseObject* op = host; op; op = op->GetUp())
+  {
+    if (op == ctx.root)
+    {
+      inside = true;
+      break;
+    }
+    path.push_back(GetSiblingIndex(op));
+  }
+  HashValue(sha, (LONG) inside);
+  HashValue(sha, (LONG) path.size());
+  if (!path.empty())
+    sha.add(path.data(), path.size() * sizeof(LONG));
+  HashValue(sha, tagIndex);
+}
+
+/// ***************************************************************************
+/// Hashes a custom data type by writing it to a HyperFile in memory.
+/// ***************************************************************************
+static void HashCustomData(SHA256& sha, const GeData& data)
+{
+  AutoAlloc<MemoryFileStruct> mfs;
+  AutoAlloc<HyperFile> hf;
+  if (!mfs || !hf) return;
+  Filename fn;
+  fn.SetMemoryWriteMode(mfs);
+  if (!hf->Open(FINGERPRINT_HYPERFILE_IDENT, fn, FILEOPEN_WRITE, FILEDIALOG_NONE)) return;
+  const Bool ok = hf->WriteGeData(data);
+  hf->Close();
+  void* mem = nullptr;
+  Int size = 0;
+  mfs->GetData(mem, size, false);
+  if (ok && mem && size > 0)
+    sha.add(mem, (size_t) size);
+}
+
+static void HashContainer(SHA256& sha, const BaseContainer* bc, HashContext& ctx,
+    Bool node=false);
+
+/// ***************************************************************************
+/// Hashes a single value. InExclude lists are hashed by the nodes they
+/// reference like links, other custom data types by their serialized
+/// form.
+/// ***************************************************************************
+static void HashData(SHA256& sha, const GeData& data, HashContext& ctx)
+{
+  const LONG type = data.GetType();
+  HashValue(sha, type);
+  switch (type)
+  {
+    case DA_NIL: break;
+    case DA_LONG: HashValue(sha, data.GetInt32()); break;
+    case DA_LLONG: HashValue(sha, data.GetInt64()); break;
+    case DA_REAL: HashValue(sha, data.GetFloat()); break;
+    case DA_TIME: HashValue(sha, data.GetTime().Get()); break;
+    case DA_VECTOR: HashValue(sha, data.GetVector()); break;
+    case DA_MATRIX: HashValue(sha, data.GetMatrix()); break;
+    case DA_STRING: HashText(sha, data.GetString()); break;
+    case DA_FILENAME: HashText(sha, data.GetFilename().GetString()); break;
+    case DA_CONTAINER: HashContainer(sha, data.GetContainer(), ctx); break;
+    case DA_ALIASLINK: HashLink(sha, data.GetLink(ctx.doc), ctx); break;
+    case CUSTOMDATATYPE_INEXCLUDE_LIST:
+    {
+      const InExcludeData* list = static_cast<const InExcludeData*>(
+        data.GetCustomDataType(CUSTOMDATATYPE_INEXCLUDE_LIST));
+      const LONG count = list ? list->GetObjectCount() : 0;
+      HashValue(sha, count);
+      for (LONG i = 0; i < count; ++i)
+      {
+        HashLink(sha, list->ObjectFromIndex(ctx.doc, i), ctx);
+        HashValue(sha, (LONG) list->GetFlags(i));
+      }
+      break;
+    }
+    default:
+      HashCustomData(sha, data);
+      break;
+  }
+}
+
+/// ***************************************************************************
+/// Hashes the values of *bc*. If *node* is true, *bc* is the data
+/// container of a node and the execution parameters are skipped.
+/// ***************************************************************************
+static void HashContainer(SHA256& sha, const BaseContainer* bc, HashContext& ctx, Bool node)
+{
+  if (!bc) return;
+  BrowseContainer browse(bc);
+  LONG id;
+  GeData* data;
+  while (browse.GetNext(&id, &data))
+  {
+    if (node && IsExecutionParameter(id)) continue;
+    HashValue(sha, id);
+    HashData(sha, *data, ctx);
+  }
+}
+
+/// ***************************************************************************
+/// Hashes the animation tracks of *node* with all of their keys.
+/// ***************************************************************************
+static void HashTracks(SHA256& sha, BaseList2D* node, HashContext& ctx)
+{
+  for (CTrack* track = node->GetFirstCTrack(); track; track = track->GetNext())
+  {
+    const DescID& id = track->GetDescriptionID();
+    HashValue(sha, (LONG) id.GetDepth());
+    for (LONG i = 0; i < id.GetDepth(); ++i)
+    {
+      HashValue(sha, (LONG) id[i].id);
+      HashValue(sha, (LONG) id[i].dtype);
+    }
+    HashContainer(sha, track->GetDataInstance(), ctx);
+
+    CCurve* curve = track->GetCurve(CCURVE_CURVE, false);
+    const LONG count = curve ? curve->GetKeyCount() : 0;
+    HashValue(sha, count);
+    for (LONG i = 0; i < count; ++i)
+    {
+      const CKey* key = curve->GetKey(i);
+      HashValue(sha, key->GetTime().Get());
+      HashValue(sha, (LONG) key->GetInterpolation());
+      HashValue(sha, key->GetValue());
+      HashValue(sha, key->GetValueLeft());
+      HashValue(sha, key->GetValueRight());
+      HashValue(sha, key->GetTimeLeft().Get());
+      HashValue(sha, key->GetTimeRight().Get());
+      HashData(sha, key->GetGeData(), ctx);
+    }
+  }
+}
+
+/// ***************************************************************************
+/// Returns the dirty counts of the tracks of *node* combined.
+/// ***************************************************************************
+static UInt32 GetTracksDirty(BaseList2D* node)
+{
+  UInt32 sum = 0;
+  for (CTrack* track = node->GetFirstCTrack(); track; track = track->GetNext())
+    sum = sum * 31 + track->GetDirty(DIRTYFLAGS_DATA) + 1;
+  return sum;
+}
+
+/// ***************************************************************************
+/// Hashes the data of *tag* that is not in its container: the elements
+/// of variable tags (UVW, vertex maps, normals, ...), the indices of
+/// selection tags and the weights of weight tags.
+/// ***************************************************************************
+static void HashTagData(SHA256& sha, BaseTag* tag, HashContext& ctx)
+{
+  switch (tag->GetType())
+  {
+    case Tuvw:
+    case Tvertexmap:
+    case Tnormal:
+    case Ttangent:
+    case Tsegment:
+    case Tvertexcolor:
+    {
+      VariableTag* vtag = static_cast<VariableTag*>(tag);
+      const LONG count = vtag->GetDataCount();
+      const LONG size = vtag->GetDataSize();
+      const void* data = vtag->GetLowlevelDataAddressR();
+      HashValue(sha, count);
+      HashValue(sha, size);
+      if (data && count > 0 && size > 0)
+        sha.add(data, (size_t) count * size);
+      break;
+    }
+    case Tpointselection:
+    case Tpolygonselection:
+    case Tedgeselection:
+    {
+      BaseSelect* sel = static_cast<SelectionTag*>(tag)->GetBaseSelect();
+      const LONG segments = sel ? sel->GetSegments() : 0;
+      HashValue(sha, segments);
+      for (LONG i = 0; i < segments; ++i)
+      {
+        Int32 a = 0, b = 0;
+        sel->GetRange(i, std::numeric_limits<Int32>::max(), &a, &b);
+        HashValue(sha, a);
+        HashValue(sha, b);
+      }
+      break;
+    }
+    case Tweights:
+    {
+      CAWeightTag* wtag = static_cast<CAWeightTag*>(tag);
+      const LONG joints = wtag->GetJointCount();
+      HashValue(sha, joints);
+      for (LONG j = 0; j < joints; ++j)
+      {
+        HashLink(sha, wtag->GetJoint(j, ctx.doc), ctx);
+        const LONG count = wtag->GetWeightCount(j);
+        HashValue(sha, count);
+        for (LONG i = 0; i < count; ++i)
+        {
+          Int32 index = 0;
+          Float weight = 0.0;
+          wtag->GetIndexWeight(j, i, index, weight);
+          HashValue(sha, index);
+          HashValue(sha, weight);
+        }
+      }
+      break;
+    }
+  }
+}
+
+/// ***************************************************************************
+/// Returns the dirty count of the document that the hashes of nodes
+/// with links depend on: the position of the linked nodes.
+/// ***************************************************************************
+static UInt32 GetLinkDirty(BaseDocument* doc)
+{
+  if (!doc) return 0;
+  return doc->GetHDirty(HDIRTYFLAGS_OBJECT_HIERARCHY) * 31 + doc->GetHDirty(HDIRTYFLAGS_MATERIAL);
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+void FingerprintCache::Flush()
+{
+  m_nodes.clear();
+  m_valid = false;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+void FingerprintCache::Compute(BaseObject* root, Fingerprint* out)
+{
+  UInt32 dirty = GetHierarchyDirty(root, DIRTYFLAGS_DATA | DIRTYFLAGS_MATRIX, true);
+  for (BaseObject* op = root->GetDown(); op; op = GetNextNode(op, root))
+  {
+    dirty = dirty * 31 + GetTracksDirty(op);
+    for (BaseTag* tag = op->GetFirstTag(); tag; tag = tag->GetNext())
+      dirty = dirty * 31 + GetTracksDirty(tag);
+  }
+  dirty = dirty * 31 + GetLinkDirty(root->GetDocument());
+  if (m_valid && dirty == m_rootDirty)
+  {
+    *out = m_root;
+    return;
+  }
+
+  TRACE_SCOPE("Fingerprint");
+  NodeMap next;
+  next.reserve(m_nodes.size());
+  SHA256 sha;
+  for (BaseObject* child = root->GetDown(); child; child = child->GetNext())
+  {
+    Fingerprint hash;
+    HashSubtree(root, child, next, &hash);
+    sha.add(hash.bytes, sizeof(hash.bytes));
+  }
+  sha.getHash(m_root.bytes);
+
+  // Only keep the nodes that are still in the hierarchy.
+  m_nodes.swap(next);
+  m_rootDirty = dirty;
+  m_valid = true;
+  *out = m_root;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+void FingerprintCache::HashSubtree(BaseObject* root, BaseObject* op, NodeMap& next,
+    Fingerprint* out)
+{
+  BaseDocument* doc = op->GetDocument();
+  UInt32 dirty = op->GetDirty(DIRTYFLAGS_DATA | DIRTYFLAGS_MATRIX) * 31 + GetTracksDirty(op);
+  for (BaseTag* tag = op->GetFirstTag(); tag; tag = tag->GetNext())
+    dirty = (dirty * 31 + tag->GetDirty(DIRTYFLAGS_DATA)) * 31 + GetTracksDirty(tag);
+  const UInt32 linkDirty = GetLinkDirty(doc);
+
+  Node node;
+  auto it = m_nodes.find(op);
+  if (it != m_nodes.end() && it->second.type == op->GetType() && it->second.dirty == dirty
+      && (!it->second.linked || it->second.linkDirty == linkDirty))
+    node = it->second;
+  else
+  {
+    HashContext ctx = { doc, root, false };
+    SHA256 sha;
+    HashValue(sha, (LONG) op->GetType());
+    HashText(sha, op->GetName());
+    HashValue(sha, op->GetMl());
+    HashContainer(sha, op->GetDataInstance(), ctx, true);
+    HashExecutionState(sha, op);
+    HashTracks(sha, op, ctx);
+    for (BaseTag* tag = op->GetFirstTag(); tag; tag = tag->GetNext())
+    {
+      HashValue(sha, (LONG) tag->GetType());
+      HashText(sha, tag->GetName());
+      HashContainer(sha, tag->GetDataInstance(), ctx, true);
+      HashExecutionState(sha, tag);
+      HashTagData(sha, tag, ctx);
+      HashTracks(sha, tag, ctx);
+    }
+    if (op->IsInstanceOf(Opoint))
+    {
+      PointObject* poly = static_cast<PointObject*>(op);
+      const LONG count = poly->GetPointCount();
+      HashValue(sha, count);
+      if (count > 0 && poly->GetPointR())
+        sha.add(poly->GetPointR(), count * sizeof(Vector));
+    }
+    if (op->IsInstanceOf(Opolygon))
+    {
+      PolygonObject* poly = static_cast<PolygonObject*>(op);
+      const LONG count = poly->GetPolygonCount();
+      HashValue(sha, count);
+      if (count > 0 && poly->GetPolygonR())
+        sha.add(poly->GetPolygonR(), count * sizeof(CPolygon));
+    }
+    node.type = op->GetType();
+    node.dirty = dirty;
+    node.linked = ctx.linked;
+    node.linkDirty = linkDirty;
+    sha.getHash(node.content.bytes);
+  }
+  next[op] = node;
+
+  // The subtree hash is cheap to combine, only the content is cached.
+  SHA256 sha;
+  sha.add(node.content.bytes, sizeof(node.content.bytes));
+  for (BaseObject* child = op->GetDown(); child; child = child->GetNext())
+  {
+    Fingerprint hash;
+    HashSubtree(root, child, next, &hash);
+    sha.add(hash.bytes, sizeof(hash.bytes));
+  }
+  sha.getHash(out->bytes);
+}
@@ -0,0 +1,78 @@
+/// Copyright (C) 2013-2015, Niklas Rosenstein
+/// All rights reserved.
+///
+/// Licensed under the GNU Lesser General Public License.
+///
+/// \file Utils/Fingerprint.h
+
+#pragma once
+
+#include <c4d.h>
+#include <c4d_legacy.h>
+#include <cstring>
+#include <unordered_map>
+
+/// ***************************************************************************
+/// A SHA-256 content hash.
+/// ***************************************************************************
+struct Fingerprint
+{
+  UChar bytes[32];
+
+  Fingerprint() { std::memset(bytes, 0, sizeof(bytes)); }
+
+  Bool operator == (const Fingerprint& other) const
+  {
+    return std::memcmp(bytes, other.bytes, sizeof(bytes)) == 0;
+  }
+
+  Bool operator != (const Fingerprint& other) const { return !(*this == other); }
+
+  /// Returns the hash as 64 lower case hex digits.
+  String ToString() const;
+};
+
+/// ***************************************************************************
+/// Computes a Merkle hash over a hierarchy. The hash of a node combines
+/// its type, name, parameters (including custom data types), local
+/// matrix, animation tracks, tags with their variable data, selections
+/// and weights, and point and polygon data with the hashes of its
+/// children. Links within the hierarchy are hashed by their relative
+/// path, so equal hierarchies have equal hashes independent of where
+/// they are in a document. The content part of every node is cached and
+/// only hashed again when its dirty counts (or those of its tags and
+/// tracks) change, or when a node it links to may have moved. Not
+/// thread-safe.
+/// ***************************************************************************
+class FingerprintCache
+{
+public:
+
+  FingerprintCache() : m_rootDirty(0), m_valid(false) { }
+
+  /// Computes the hash of the children of *root* (not *root* itself).
+  void Compute(BaseObject* root, Fingerprint* out);
+
+  /// Forgets all cached hashes.
+  void Flush();
+
+private:
+
+  struct Node
+  {
+    LONG type;
+    UInt32 dirty;
+    Bool linked;        ///< True if the content depends on #linkDirty.
+    UInt32 linkDirty;
+    Fingerprint content;
+  };
+
+  typedef std::unordered_map<BaseList2D*, Node> NodeMap;
+
+  void HashSubtree(BaseObject* root, BaseObject* op, NodeMap& next, Fingerprint* out);
+
+  NodeMap m_nodes;
+  UInt32 m_rootDirty;
+  Bool m_valid;
+  Fingerprint m_root;
+};
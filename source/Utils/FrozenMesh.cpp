@@ -0,0 +1,402 @@
+/// Copyright (C) 2013-2015, Niklas Rosenstein
+/// All rights reserved.
+///
+/// Licensed under the GNU Lesser General Public License.
+///
+/// \file Utils/FrozenMesh.cpp
+
+#include "FrozenMesh.h"
+#include "Misc.h"
+#include "Suspend.h"
+#include <algorithm>
+
+/// ***************************************************************************
+/// Stacks the texture tags of *op* on top of *layers*. An unrestricted
+/// tag covers all layers below it, so they are dropped.
+/// ***************************************************************************
+static void AddTextureLayers(BaseObject* op, FrozenMesh::TextureLayers& layers)
+{
+  GeData data;
+  for (BaseTag* tag = op->GetFirstTag(); tag; tag = tag->GetNext())
+  {
+    if (tag->GetType() != Ttexture) continue;
+    BaseMaterial* mat = static_cast<TextureTag*>(tag)->GetMaterial();
+    if (!mat) continue;
+    FrozenMesh::TextureLayer layer;
+    layer.material = mat;
+    if (tag->GetParameter(TEXTURETAG_RESTRICTION, data, DESCFLAGS_GET_0))
+      layer.restriction = data.GetString();
+    if (layer.restriction.GetLength() == 0)
+      layers.clear();
+    layers.push_back(layer);
+  }
+}
+
+/// ***************************************************************************
+/// Returns the polygon selection tag of *op* named *name*.
+/// ***************************************************************************
+static SelectionTag* FindPolygonSelection(BaseObject* op, const String& name)
+{
+  for (BaseTag* tag = op->GetFirstTag(); tag; tag = tag->GetNext())
+  {
+    if (tag->GetType() == Tpolygonselection && tag->GetName() == name)
+      return static_cast<SelectionTag*>(tag);
+  }
+  return nullptr;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+void FrozenMesh::Flush()
+{
+  for (Group& group : m_groups)
+  {
+    if (group.material)
+      BaseLink::Free(group.material);
+  }
+  m_groups.clear();
+  m_points.clear();
+  m_polys.clear();
+  m_uvws.clear();
+  m_bbmin = m_bbmax = Vector(0.0);
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+Bool FrozenMesh::Build(BaseObject* root)
+{
+  Flush();
+  if (!root) return false;
+  const Matrix img = ~root->GetMg();
+  TextureLayers layers;
+  AddTextureLayers(root, layers);
+  for (BaseObject* child = root->GetDown(); child; child = child->GetNext())
+    Collect(child, img * child->GetMg(), false, layers);
+  UpdateBounds();
+  return true;
+}
+
+/// ***************************************************************************
+/// Walks *op* and its caches. *mg* is the matrix of *op* in mesh space,
+/// *cache* is true if *op* is part of a cache rather than the document.
+/// *inherited* are the texture tags of the parents.
+/// ***************************************************************************
+void FrozenMesh::Collect(BaseObject* op, const Matrix& mg, Bool cache,
+    const TextureLayers& inherited)
+{
+  if (!cache)
+  {
+    // Inputs of generators are part of the generator's cache, and
+    // nodes that are out of execution or hidden don't render.
+    if (IsControlledByGenerator(op)) return;
+    if (GetSuspendReasons(op) || op->GetRenderMode() == MODE_OFF) return;
+  }
+
+  TextureLayers layers = inherited;
+  AddTextureLayers(op, layers);
+
+  // A deform cache replaces the object itself and has its matrix,
+  // a generator cache is placed relative to the generator.
+  BaseObject* deformCache = op->GetDeformCache();
+  BaseObject* cacheRoot = deformCache ? nullptr : op->GetCache();
+  if (deformCache)
+    Collect(deformCache, mg, true, layers);
+  else if (cacheRoot)
+    Collect(cacheRoot, mg * cacheRoot->GetMl(), true, layers);
+  else if (op->IsInstanceOf(Opolygon))
+    AddPolygons(static_cast<PolygonObject*>(op), mg, layers);
+
+  for (BaseObject* child = op->GetDown(); child; child = child->GetNext())
+    Collect(child, mg * child->GetMl(), cache, layers);
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+void FrozenMesh::AddPolygons(PolygonObject* op, const Matrix& mg, const TextureLayers& layers)
+{
+  const Vector* points = op->GetPointR();
+  const CPolygon* polys = op->GetPolygonR();
+  const LONG pointCount = op->GetPointCount();
+  const LONG polyCount = op->GetPolygonCount();
+  if (!points || !polys || polyCount <= 0) return;
+
+  const LONG pointBase = (LONG) m_points.size();
+  const LONG polyBase = (LONG) m_polys.size();
+  m_points.reserve(m_points.size() + pointCount);
+  for (LONG i = 0; i < pointCount; ++i)
+    m_points.push_back(mg * points[i]);
+
+  UVWTag* uvw = static_cast<UVWTag*>(op->GetTag(Tuvw));
+  if (uvw && uvw->GetDataCount() != polyCount)
+    uvw = nullptr;
+
+  // Later layers are on top. Restricted layers only cover the polygons
+  // of the selection tag with the restriction's name on this object.
+  std::vector<BaseMaterial*> materials(polyCount, nullptr);
+  for (const TextureLayer& layer : layers)
+  {
+    if (layer.restriction.GetLength() == 0)
+    {
+      std::fill(materials.begin(), materials.end(), layer.material);
+      continue;
+    }
+    SelectionTag* sel = FindPolygonSelection(op, layer.restriction);
+    BaseSelect* bs = sel ? sel->GetBaseSelect() : nullptr;
+    if (!bs) continue;
+    LONG a = 0, b = 0;
+    for (LONG seg = 0; bs->GetRange(seg, polyCount, &a, &b); ++seg)
+    {
+      for (LONG i = a; i <= b && i < polyCount; ++i)
+        materials[i] = layer.material;
+    }
+  }
+
+  m_polys.reserve(m_polys.size() + polyCount);
+  m_uvws.reserve(m_uvws.size() + polyCount);
+  BaseMaterial* last = nullptr;
+  size_t group = (size_t) -1;
+  for (LONG i = 0; i < polyCount; ++i)
+  {
+    const CPolygon& p = polys[i];
+    m_polys.push_back(CPolygon(p.a + pointBase, p.b + pointBase, p.c + pointBase, p.d + pointBase));
+    m_uvws.push_back(uvw ? uvw->GetSlow(i) : UVWStruct());
+    if (group == (size_t) -1 || materials[i] != last)
+    {
+      last = materials[i];
+      group = GetGroup(last);
+    }
+    m_groups[group].polys.push_back(polyBase + i);
+  }
+}
+
+/// ***************************************************************************
+/// Returns the index of the group for *material*, creating it if needed.
+/// ***************************************************************************
+size_t FrozenMesh::GetGroup(BaseMaterial* material)
+{
+  for (size_t i = 0; i < m_groups.size(); ++i)
+  {
+    BaseList2D* link = m_groups[i].material ? m_groups[i].material->ForceGetLink() : nullptr;
+    if (link == material) return i;
+  }
+  Group group;
+  group.name = "Frozen." + LongToString((LONG) m_groups.size());
+  group.material = nullptr;
+  if (material)
+  {
+    group.material = BaseLink::Alloc();
+    if (group.material)
+      group.material->SetLink(material);
+  }
+  m_groups.push_back(group);
+  return m_groups.size() - 1;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+void FrozenMesh::UpdateBounds()
+{
+  m_bbmin = m_bbmax = Vector(0.0);
+  if (m_points.empty()) return;
+  m_bbmin = m_bbmax = m_points[0];
+  for (const Vector& p : m_points)
+  {
+    m_bbmin = Vector(Min(m_bbmin.x, p.x), Min(m_bbmin.y, p.y), Min(m_bbmin.z, p.z));
+    m_bbmax = Vector(Max(m_bbmax.x, p.x), Max(m_bbmax.y, p.y), Max(m_bbmax.z, p.z));
+  }
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+void FrozenMesh::GetBounds(Vector* mp, Vector* rad) const
+{
+  *mp = (m_bbmin + m_bbmax) * 0.5;
+  *rad = (m_bbmax - m_bbmin) * 0.5;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+PolygonObject* FrozenMesh::CreateObject(BaseDocument* doc) const
+{
+  PolygonObject* op = PolygonObject::Alloc((LONG) m_points.size(), (LONG) m_polys.size());
+  if (!op) return nullptr;
+  if (!m_points.empty())
+    CopyMem(m_points.data(), op->GetPointW(), m_points.size() * sizeof(Vector));
+  if (!m_polys.empty())
+    CopyMem(m_polys.data(), op->GetPolygonW(), m_polys.size() * sizeof(CPolygon));
+
+  UVWTag* uvw = UVWTag::Alloc((LONG) m_polys.size());
+  if (uvw)
+  {
+    for (size_t i = 0; i < m_uvws.size(); ++i)
+      uvw->SetSlow((LONG) i, m_uvws[i]);
+    op->InsertTag(uvw);
+  }
+
+  for (const Group& group : m_groups)
+  {
+    BaseList2D* material = group.material ? group.material->GetLink(doc, Mbase) : nullptr;
+    if (!material) continue;
+
+    SelectionTag* sel = SelectionTag::Alloc(Tpolygonselection);
+    TextureTag* tex = TextureTag::Alloc();
+    if (!sel || !tex)
+    {
+      SelectionTag::Free(sel);
+      TextureTag::Free(tex);
+      break;
+    }
+    sel->SetName(group.name);
+    BaseSelect* bs = sel->GetBaseSelect();
+    for (LONG index : group.polys)
+      bs->Select(index);
+    tex->SetMaterial(static_cast<BaseMaterial*>(material));
+    tex->SetParameter(TEXTURETAG_RESTRICTION, group.name, DESCFLAGS_SET_0);
+    tex->SetParameter(TEXTURETAG_PROJECTION, TEXTURETAG_PROJECTION_UVW, DESCFLAGS_SET_0);
+    op->InsertTag(sel, op->GetLastTag());
+    op->InsertTag(tex, sel);
+  }
+
+  op->Message(MSG_UPDATE);
+  return op;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+Int64 FrozenMesh::GetMemorySize() const
+{
+  Int64 size = m_points.capacity() * sizeof(Vector);
+  size += m_polys.capacity() * sizeof(CPolygon);
+  size += m_uvws.capacity() * sizeof(UVWStruct);
+  for (const Group& group : m_groups)
+    size += sizeof(Group) + group.polys.capacity() * sizeof(LONG);
+  return size;
+}
+
+/// ***************************************************************************
+/// Reads an array of *T* written with #WriteArray().
+/// ***************************************************************************
+template <typename T>
+static Bool ReadArray(HyperFile* hf, std::vector<T>& out)
+{
+  void* data = nullptr;
+  Int size = 0;
+  if (!hf->ReadMemory(&data, &size)) return false;
+  out.resize(size / sizeof(T));
+  if (data)
+  {
+    if (!out.empty())
+      CopyMem(data, out.data(), out.size() * sizeof(T));
+    DeleteMem(data);
+  }
+  return true;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+template <typename T>
+static Bool WriteArray(HyperFile* hf, const std::vector<T>& in)
+{
+  return hf->WriteMemory(in.data(), in.size() * sizeof(T));
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+Bool FrozenMesh::Read(HyperFile* hf)
+{
+  Flush();
+  if (!ReadArray(hf, m_points)) return false;
+  if (!ReadArray(hf, m_polys)) return false;
+  if (!ReadArray(hf, m_uvws)) return false;
+
+  // CreateObject() indexes with these, a damaged scene must not get
+  // that far.
+  const LONG pointCount = (LONG) m_points.size();
+  for (const CPolygon& p : m_polys)
+  {
+    if (p.a < 0 || p.a >= pointCount || p.b < 0 || p.b >= pointCount
+        || p.c < 0 || p.c >= pointCount || p.d < 0 || p.d >= pointCount)
+    {
+      Flush();
+      return false;
+    }
+  }
+  if (m_uvws.size() != m_polys.size())
+  {
+    Flush();
+    return false;
+  }
+
+  Int32 groupCount = 0;
+  if (!hf->ReadInt32(&groupCount)) return false;
+  for (Int32 i = 0; i < groupCount; ++i)
+  {
+    Group group;
+    group.material = nullptr;
+    Bool hasMaterial = false;
+    if (!hf->ReadString(&group.name)) return false;
+    if (!hf->ReadBool(&hasMaterial)) return false;
+    if (hasMaterial)
+    {
+      group.material = BaseLink::Alloc();
+      if (!group.material || !group.material->Read(hf))
+      {
+        BaseLink::Free(group.material);
+        return false;
+      }
+    }
+    m_groups.push_back(group);
+    if (!ReadArray(hf, m_groups.back().polys)) return false;
+    for (LONG index : m_groups.back().polys)
+    {
+      if (index < 0 || index >= (LONG) m_polys.size())
+      {
+        Flush();
+        return false;
+      }
+    }
+  }
+
+  UpdateBounds();
+  return true;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+Bool FrozenMesh::Write(HyperFile* hf) const
+{
+  if (!WriteArray(hf, m_points)) return false;
+  if (!WriteArray(hf, m_polys)) return false;
+  if (!WriteArray(hf, m_uvws)) return false;
+
+  if (!hf->WriteInt32((Int32) m_groups.size())) return false;
+  for (const Group& group : m_groups)
+  {
+    if (!hf->WriteString(group.name)) return false;
+    if (!hf->WriteBool(group.material != nullptr)) return false;
+    if (group.material && !group.material->Write(hf)) return false;
+    if (!WriteArray(hf, group.polys)) return false;
+  }
+  return true;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+Bool FrozenMesh::CopyTo(FrozenMesh& dest, COPYFLAGS flags, AliasTrans* at) const
+{
+  dest.Flush();
+  dest.m_points = m_points;
+  dest.m_polys = m_polys;
+  dest.m_uvws = m_uvws;
+  dest.m_bbmin = m_bbmin;
+  dest.m_bbmax = m_bbmax;
+  for (const Group& group : m_groups)
+  {
+    Group copy;
+    copy.name = group.name;
+    copy.polys = group.polys;
+    copy.material = group.material ? group.material->GetClone(flags, at) : nullptr;
+    dest.m_groups.push_back(copy);
+  }
+  return true;
+}
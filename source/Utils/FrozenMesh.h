@@ -0,0 +1,84 @@
+/// Copyright (C) 2013-2015, Niklas Rosenstein
+/// All rights reserved.
+///
+/// Licensed under the GNU Lesser General Public License.
+///
+/// \file Utils/FrozenMesh.h
+
+#pragma once
+
+#include <c4d.h>
+#include <c4d_legacy.h>
+#include <vector>
+
+/// ***************************************************************************
+/// The polygon caches of a hierarchy merged into a single mesh, with one
+/// polygon selection per material. Points are stored in the space of the
+/// root object passed to #Build().
+/// ***************************************************************************
+class FrozenMesh
+{
+public:
+
+  /// The polygons that use the same material.
+  struct Group
+  {
+    String name;
+    BaseLink* material;
+    std::vector<LONG> polys;
+  };
+
+  /// A texture tag that applies to the collected polygons, restricted
+  /// to the polygon selection named *restriction* if it is not empty.
+  struct TextureLayer
+  {
+    BaseMaterial* material;
+    String restriction;
+  };
+
+  typedef std::vector<TextureLayer> TextureLayers;
+
+  FrozenMesh() { }
+  ~FrozenMesh() { Flush(); }
+
+  /// Frees all data.
+  void Flush();
+
+  /// Returns true if the mesh holds no polygons.
+  Bool IsEmpty() const { return m_polys.empty(); }
+
+  /// Merges the current caches of all children of *root*. The caches
+  /// must be up to date, ie. the document must have been executed.
+  Bool Build(BaseObject* root);
+
+  /// Creates a polygon object from the mesh, including UVW, polygon
+  /// selection and texture tags. Material links are resolved in *doc*.
+  PolygonObject* CreateObject(BaseDocument* doc) const;
+
+  /// Computes the bounding box of the mesh.
+  void GetBounds(Vector* mp, Vector* rad) const;
+
+  /// Returns the approximate number of bytes held by the mesh.
+  Int64 GetMemorySize() const;
+
+  Bool Read(HyperFile* hf);
+  Bool Write(HyperFile* hf) const;
+  Bool CopyTo(FrozenMesh& dest, COPYFLAGS flags, AliasTrans* at) const;
+
+private:
+
+  FrozenMesh(const FrozenMesh&);
+  FrozenMesh& operator = (const FrozenMesh&);
+
+  void Collect(BaseObject* op, const Matrix& mg, Bool cache, const TextureLayers& inherited);
+  void AddPolygons(PolygonObject* op, const Matrix& mg, const TextureLayers& layers);
+  size_t GetGroup(BaseMaterial* material);
+  void UpdateBounds();
+
+  Vector m_bbmin;
+  Vector m_bbmax;
+  std::vector<Vector> m_points;
+  std::vector<CPolygon> m_polys;
+  std::vector<UVWStruct> m_uvws;
+  std::vector<Group> m_groups;
+};
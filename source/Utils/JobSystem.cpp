@@ -0,0 +1,297 @@
+/// Copyright (C) 2013-2015, Niklas Rosenstein
+/// All rights reserved.
+///
+/// Licensed under the GNU Lesser General Public License.
+///
+/// \file Utils/JobSystem.cpp
+
+#include "JobSystem.h"
+#include "Trace.h"
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+
+/// ***************************************************************************
+/// A queued job and the group it belongs to.
+/// ***************************************************************************
+struct Job
+{
+  std::function<void()> fn;
+  JobGroup* group;
+};
+
+/// ***************************************************************************
+/// The deque of a worker. The owner pushes and pops at the back,
+/// thieves take from the front.
+/// ***************************************************************************
+struct JobQueue
+{
+  std::mutex lock;
+  std::deque<Job> jobs;
+};
+
+class JobWorker;
+
+/// ***************************************************************************
+/// The state of the scheduler. Queue 0 takes the jobs of threads that
+/// are not workers, queue i + 1 belongs to worker i.
+/// ***************************************************************************
+struct JobSystemImpl
+{
+  std::vector<std::unique_ptr<JobQueue>> queues;
+  std::vector<JobWorker*> workers;
+
+  /// Guards the sleep of idle workers and of waiting groups.
+  std::mutex sleepLock;
+  std::condition_variable wake;
+  std::condition_variable done;
+  std::atomic<LONG> queued;
+  std::atomic<bool> stop;
+
+  JobSystemImpl() : queued(0), stop(false) { }
+
+  /// Returns the queue of the current thread in this scheduler.
+  LONG Self() const;
+
+  void Push(Job job, LONG self);
+  Bool Pop(Job* job, LONG self);
+  void Execute(Job& job);
+};
+
+/// The scheduler and queue index of the current thread if it is a
+/// worker. Other threads use queue 0.
+static thread_local const JobSystemImpl* t_system = nullptr;
+static thread_local LONG t_queue = 0;
+
+/// ***************************************************************************
+/// ***************************************************************************
+LONG JobSystemImpl::Self() const
+{
+  return t_system == this ? t_queue : 0;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+class JobWorker : public C4DThread
+{
+public:
+
+  JobWorker(JobSystemImpl* sys, LONG queue) : m_sys(sys), m_queue(queue) { }
+
+  virtual void Main() override
+  {
+    t_system = m_sys;
+    t_queue = m_queue;
+    JobSystemImpl& sys = *m_sys;
+    for (;;)
+    {
+      Job job;
+      if (sys.Pop(&job, m_queue))
+      {
+        sys.Execute(job);
+        continue;
+      }
+      std::unique_lock<std::mutex> lock(sys.sleepLock);
+      sys.wake.wait(lock, [&sys]() {
+        return sys.stop.load() || sys.queued.load() > 0;
+      });
+      if (sys.stop.load() && sys.queued.load() == 0) break;
+    }
+  }
+
+  virtual const Char* GetThreadName() override { return "NRContainerJobWorker"; }
+
+private:
+  JobSystemImpl* m_sys;
+  LONG m_queue;
+};
+
+/// ***************************************************************************
+/// ***************************************************************************
+void JobSystemImpl::Push(Job job, LONG self)
+{
+  JobQueue& queue = *queues[self];
+  {
+    std::lock_guard<std::mutex> lock(queue.lock);
+    queue.jobs.push_back(std::move(job));
+  }
+  {
+    // Taking the lock orders the increment with the check of a worker
+    // that is about to sleep.
+    std::lock_guard<std::mutex> lock(sleepLock);
+    queued.fetch_add(1);
+  }
+  wake.notify_one();
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+Bool JobSystemImpl::Pop(Job* job, LONG self)
+{
+  if (queued.load() == 0) return false;
+  {
+    JobQueue& queue = *queues[self];
+    std::lock_guard<std::mutex> lock(queue.lock);
+    if (!queue.jobs.empty())
+    {
+      *job = std::move(queue.jobs.back());
+      queue.jobs.pop_back();
+      queued.fetch_sub(1);
+      return true;
+    }
+  }
+  const LONG count = (LONG) queues.size();
+  for (LONG i = 1; i < count; ++i)
+  {
+    JobQueue& victim = *queues[(self + i) % count];
+    std::lock_guard<std::mutex> lock(victim.lock);
+    if (victim.jobs.empty()) continue;
+    *job = std::move(victim.jobs.front());
+    victim.jobs.pop_front();
+    queued.fetch_sub(1);
+    return true;
+  }
+  return false;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+void JobSystemImpl::Execute(Job& job)
+{
+  JobGroup* group = job.group;
+  if (!group->IsCancelled())
+    job.fn();
+  job.fn = nullptr;
+  if (group->m_pending.fetch_sub(1) == 1)
+  {
+    std::lock_guard<std::mutex> lock(sleepLock);
+    done.notify_all();
+  }
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+Bool JobSystem::Start(LONG workers)
+{
+  if (m_impl) return true;
+  TRACE_SCOPE("JobSystemStart");
+  if (workers < 0)
+    workers = std::max<LONG>(0, GeGetCurrentThreadCount() - 1);
+  if (workers == 0) return true;
+
+  JobSystemImpl* impl = gNew(JobSystemImpl);
+  if (!impl) return false;
+  for (LONG i = 0; i <= workers; ++i)
+    impl->queues.emplace_back(new JobQueue);
+  for (LONG i = 0; i < workers; ++i)
+  {
+    JobWorker* worker = gNew(JobWorker, impl, i + 1);
+    if (!worker) break;
+    if (!worker->Start(THREADMODE_ASYNC, THREADPRIORITY_NORMAL))
+    {
+      gDelete(worker);
+      break;
+    }
+    impl->workers.push_back(worker);
+  }
+  if (impl->workers.empty())
+  {
+    gDelete(impl);
+    return false;
+  }
+  m_impl = impl;
+  return true;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+void JobSystem::Stop()
+{
+  if (!m_impl) return;
+  TRACE_SCOPE("JobSystemStop");
+  {
+    std::lock_guard<std::mutex> lock(m_impl->sleepLock);
+    m_impl->stop.store(true);
+  }
+  m_impl->wake.notify_all();
+  for (JobWorker* worker : m_impl->workers)
+  {
+    worker->Wait(false);
+    gDelete(worker);
+  }
+  gDelete(m_impl);
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+LONG JobSystem::GetConcurrency() const
+{
+  return m_impl ? (LONG) m_impl->workers.size() + 1 : 1;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+JobSystem& JobSystem::Global()
+{
+  static JobSystem global;
+  return global;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+Bool JobSystemInit(LONG workers)
+{
+  return JobSystem::Global().Start(workers);
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+void JobSystemShutdown()
+{
+  JobSystem::Global().Stop();
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+LONG JobSystemGetConcurrency()
+{
+  return JobSystem::Global().GetConcurrency();
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+void JobGroup::Run(std::function<void()> fn)
+{
+  if (!m_sys || m_sys->stop.load())
+  {
+    if (!IsCancelled())
+      fn();
+    return;
+  }
+  m_pending.fetch_add(1);
+  m_sys->Push(Job{std::move(fn), this}, m_sys->Self());
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+void JobGroup::Wait()
+{
+  if (m_pending.load() == 0) return;
+  JobSystemImpl& sys = *m_sys;
+  const LONG self = sys.Self();
+  while (m_pending.load() > 0)
+  {
+    Job job;
+    if (sys.Pop(&job, self))
+    {
+      sys.Execute(job);
+      continue;
+    }
+    // The remaining jobs of the group are running on other threads.
+    std::unique_lock<std::mutex> lock(sys.sleepLock);
+    sys.done.wait(lock, [this, &sys]() {
+      return m_pending.load() == 0 || sys.queued.load() > 0;
+    });
+  }
+}
@@ -0,0 +1,196 @@
+/// Copyright (C) 2013-2015, Niklas Rosenstein
+/// All rights reserved.
+///
+/// Licensed under the GNU Lesser General Public License.
+///
+/// \file Utils/JobSystem.h
+///
+/// A small work-stealing scheduler for the plugin's internal parallel
+/// loops. The workers are C4DThreads, one less than Cinema 4D's thread
+/// count, each with its own deque of jobs. Workers take jobs from the
+/// back of their own deque and steal from the front of the others, and
+/// sleep on a condition variable while there is no work. A thread that
+/// waits for a #JobGroup runs pending jobs in the meantime, so groups
+/// can be nested. Without workers (before JobSystemInit() or on single
+/// core machines) all jobs run on the calling thread.
+///
+/// The plugin shares one global scheduler. Code that needs a scheduler
+/// of a specific size (eg. the benchmark suite) creates its own
+/// #JobSystem instead of restarting the global one.
+
+#pragma once
+
+#include <c4d.h>
+#include <c4d_legacy.h>
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <vector>
+
+struct JobSystemImpl;
+
+/// ***************************************************************************
+/// A scheduler with its own worker threads. The global scheduler used by
+/// JobGroup, ParallelFor() and ParallelReduce() by default is managed
+/// with JobSystemInit() and JobSystemShutdown().
+/// ***************************************************************************
+class JobSystem
+{
+public:
+
+  JobSystem() : m_impl(nullptr) { }
+  ~JobSystem() { Stop(); }
+
+  /// Starts *workers* worker threads, or one less than Cinema 4D's
+  /// thread count if *workers* is negative. Does nothing if running.
+  Bool Start(LONG workers=NOTOK);
+
+  /// Stops the workers. Pending jobs are finished first. No group of
+  /// this scheduler may be waited for while it stops.
+  void Stop();
+
+  /// Returns the number of threads that run jobs, the calling thread
+  /// included.
+  LONG GetConcurrency() const;
+
+  /// Returns the global scheduler.
+  static JobSystem& Global();
+
+private:
+
+  JobSystem(const JobSystem&);
+  JobSystem& operator = (const JobSystem&);
+
+  friend class JobGroup;
+  JobSystemImpl* m_impl;
+};
+
+/// ***************************************************************************
+/// Starts the global scheduler with *workers* worker threads, or one
+/// less than Cinema 4D's thread count if *workers* is negative. Called
+/// from PluginStart().
+/// ***************************************************************************
+Bool JobSystemInit(LONG workers=NOTOK);
+
+/// ***************************************************************************
+/// Stops the workers of the global scheduler. Pending jobs are finished
+/// first. Called from PluginEnd().
+/// ***************************************************************************
+void JobSystemShutdown();
+
+/// ***************************************************************************
+/// Returns the number of threads that run jobs on the global scheduler,
+/// the calling thread included.
+/// ***************************************************************************
+LONG JobSystemGetConcurrency();
+
+/// ***************************************************************************
+/// A set of jobs that can be waited for and cancelled together. Jobs
+/// that have not started when the group is cancelled are skipped, the
+/// ones that run can poll IsCancelled(). The destructor waits. The
+/// jobs run on *system*, or on the global scheduler.
+/// ***************************************************************************
+class JobGroup
+{
+public:
+
+  explicit JobGroup(JobSystem& system=JobSystem::Global())
+    : m_sys(system.m_impl), m_pending(0), m_cancelled(false) { }
+  ~JobGroup() { Wait(); }
+
+  /// Queues *fn* for execution.
+  void Run(std::function<void()> fn);
+
+  /// Runs pending jobs until all jobs of this group are done.
+  void Wait();
+
+  void Cancel() { m_cancelled.store(true, std::memory_order_relaxed); }
+  Bool IsCancelled() const { return m_cancelled.load(std::memory_order_relaxed); }
+
+private:
+
+  JobGroup(const JobGroup&);
+  JobGroup& operator = (const JobGroup&);
+
+  friend struct JobSystemImpl;
+  JobSystemImpl* m_sys;
+  std::atomic<LONG> m_pending;
+  std::atomic<bool> m_cancelled;
+};
+
+/// ***************************************************************************
+/// Calls *fn(i)* for every *i* from *begin* to *end* (exclusive), split
+/// into chunks of at least *grain* indices, on the scheduler *system*.
+/// ***************************************************************************
+template <typename Fn>
+void ParallelFor(JobSystem& system, LONG begin, LONG end, LONG grain, Fn fn)
+{
+  if (end <= begin) return;
+  const LONG count = end - begin;
+  const LONG threads = system.GetConcurrency();
+  const LONG chunk = std::max<LONG>(std::max<LONG>(grain, 1), (count + threads * 4 - 1) / (threads * 4));
+  if (threads <= 1 || count <= chunk)
+  {
+    for (LONG i = begin; i < end; ++i)
+      fn(i);
+    return;
+  }
+  JobGroup group(system);
+  for (LONG lo = begin; lo < end; lo += chunk)
+  {
+    const LONG hi = std::min(lo + chunk, end);
+    group.Run([&fn, lo, hi]() {
+      for (LONG i = lo; i < hi; ++i)
+        fn(i);
+    });
+  }
+  group.Wait();
+}
+
+/// ***************************************************************************
+/// ParallelFor() on the global scheduler.
+/// ***************************************************************************
+template <typename Fn>
+void ParallelFor(LONG begin, LONG end, LONG grain, Fn fn)
+{
+  ParallelFor(JobSystem::Global(), begin, end, grain, fn);
+}
+
+/// ***************************************************************************
+/// Computes *map(lo, hi)* for chunks of the range from *begin* to *end*
+/// and combines the results with *reduce* in the order of the chunks,
+/// starting with *identity*, on the scheduler *system*.
+/// ***************************************************************************
+template <typename T, typename Map, typename Reduce>
+T ParallelReduce(JobSystem& system, LONG begin, LONG end, LONG grain, T identity, Map map, Reduce reduce)
+{
+  if (end <= begin) return identity;
+  const LONG count = end - begin;
+  const LONG threads = system.GetConcurrency();
+  const LONG chunk = std::max<LONG>(std::max<LONG>(grain, 1), (count + threads * 4 - 1) / (threads * 4));
+  if (threads <= 1 || count <= chunk)
+    return reduce(identity, map(begin, end));
+
+  std::vector<T> partial((count + chunk - 1) / chunk, identity);
+  JobGroup group(system);
+  for (LONG lo = begin, i = 0; lo < end; lo += chunk, ++i)
+  {
+    const LONG hi = std::min(lo + chunk, end);
+    T* out = &partial[i];
+    group.Run([&map, lo, hi, out]() { *out = map(lo, hi); });
+  }
+  group.Wait();
+  T result = identity;
+  for (const T& value : partial)
+    result = reduce(result, value);
+  return result;
+}
+
+/// ***************************************************************************
+/// ParallelReduce() on the global scheduler.
+/// ***************************************************************************
+template <typename T, typename Map, typename Reduce>
+T ParallelReduce(LONG begin, LONG end, LONG grain, T identity, Map map, Reduce reduce)
+{
+  return ParallelReduce<T>(JobSystem::Global(), begin, end, grain, identity, map, reduce);
+}
@@ -7,11 +7,20 @@
 /// \lastmodified 2015/05/06
 
 #include <c4d_apibridge.h>
+#include <customgui_inexclude.h>
 #include "Misc.h"
 #include "res/c4d_symbols.h"
 
 using c4d_apibridge::IsEmpty;
 
+/// Layout of the container used by #FindMenuResourceCached().
+enum
+{
+  MENUCACHE_KEY = 1,
+  MENUCACHE_DEPTH = 2,
+  MENUCACHE_PATH = 100,
+};
+
 /// ***************************************************************************
 /// ***************************************************************************
 class _PasswordDialog : public GeDialog
@@ -139,3 +148,149 @@ Bool FindMenuResource(BaseContainer& menu, const String& subtitle, BaseContainer
   }
   return false;
 }
+
+/// ***************************************************************************
+/// Same as #FindMenuResource(), but records the data indices that lead
+/// to the submenu in \p path.
+/// ***************************************************************************
+static Bool FindMenuPath(BaseContainer& menu, const String& subtitle, BaseContainer** bc, BaseContainer& path, LONG depth)
+{
+  if (menu.GetString(MENURESOURCE_SUBTITLE) == subtitle) {
+    *bc = &menu;
+    path.SetInt32(MENUCACHE_DEPTH, depth);
+    return true;
+  }
+  LONG index = 0;
+  GeData* data = nullptr;
+  while ((data = menu.GetIndexData(index++)) != nullptr) {
+    BaseContainer* submenu = (data->GetType() == DA_CONTAINER ? data->GetContainer() : nullptr);
+    if (submenu && FindMenuPath(*submenu, subtitle, bc, path, depth + 1)) {
+      path.SetInt32(MENUCACHE_PATH + depth, index - 1);
+      return true;
+    }
+  }
+  return false;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+Bool FindMenuResourceCached(const String& name, const String& subtitle, LONG cacheId, BaseContainer** bc)
+{
+  BaseContainer* menu = GetMenuResource(name);
+  if (!menu) return false;
+
+  const String key = name + ":" + subtitle;
+  BaseContainer* cache = GetWorldPluginData(cacheId);
+  if (cache && cache->GetString(MENUCACHE_KEY) == key) {
+    BaseContainer* current = menu;
+    const LONG depth = cache->GetInt32(MENUCACHE_DEPTH);
+    for (LONG i = 0; i < depth && current; ++i) {
+      GeData* data = current->GetIndexData(cache->GetInt32(MENUCACHE_PATH + i, -1));
+      current = (data && data->GetType() == DA_CONTAINER ? data->GetContainer() : nullptr);
+    }
+    if (current && current->GetString(MENURESOURCE_SUBTITLE) == subtitle) {
+      *bc = current;
+      return true;
+    }
+  }
+
+  BaseContainer path;
+  if (!FindMenuPath(*menu, subtitle, bc, path, 0))
+    return false;
+  path.SetString(MENUCACHE_KEY, key);
+  SetWorldPluginData(cacheId, path, false);
+  return true;
+}
+
+/// ***************************************************************************
+/// Adds all nodes linked from *bc* and its sub-containers to *refs*,
+/// including the objects of InExclude lists.
+/// ***************************************************************************
+void CollectLinks(const BaseContainer* bc, BaseDocument* doc, std::set<BaseList2D*>& refs)
+{
+  if (!bc) return;
+  BrowseContainer browse(bc);
+  LONG id;
+  GeData* data;
+  while (browse.GetNext(&id, &data))
+  {
+    switch (data->GetType())
+    {
+      case DA_ALIASLINK:
+      {
+        BaseList2D* link = data->GetLink(doc);
+        if (link) refs.insert(link);
+        break;
+      }
+      case DA_CONTAINER:
+        CollectLinks(data->GetContainer(), doc, refs);
+        break;
+      case CUSTOMDATATYPE_INEXCLUDE_LIST:
+      {
+        InExcludeData* list = static_cast<InExcludeData*>(
+          data->GetCustomDataType(CUSTOMDATATYPE_INEXCLUDE_LIST));
+        if (!list) break;
+        for (LONG i = 0; i < list->GetObjectCount(); ++i)
+        {
+          BaseList2D* link = list->ObjectFromIndex(doc, i);
+          if (link) refs.insert(link);
+        }
+        break;
+      }
+    }
+  }
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+Bool TranslateLinks(BaseContainer* bc, BaseDocument* doc, const LinkMap& map)
+{
+  if (!bc || map.empty()) return false;
+  Bool changed = false;
+  LONG id;
+  for (LONG i = 0; (id = bc->GetIndexId(i)) != NOTOK; ++i)
+  {
+    const GeData* data = bc->GetIndexData(i);
+    switch (data->GetType())
+    {
+      case DA_ALIASLINK:
+      {
+        auto it = map.find(static_cast<BaseList2D*>(data->GetLinkAtom(doc)));
+        if (it == map.end()) break;
+        bc->SetLink(id, it->second);
+        changed = true;
+        break;
+      }
+      case DA_CONTAINER:
+      {
+        BaseContainer sub = data->GetContainer();
+        if (!TranslateLinks(&sub, doc, map)) break;
+        bc->SetContainer(id, sub);
+        changed = true;
+        break;
+      }
+      case CUSTOMDATATYPE_INEXCLUDE_LIST:
+      {
+        GeData copy(*data);
+        InExcludeData* list = static_cast<InExcludeData*>(
+          copy.GetCustomDataType(CUSTOMDATATYPE_INEXCLUDE_LIST));
+        if (!list) break;
+        Bool listChanged = false;
+        for (LONG j = list->GetObjectCount() - 1; j >= 0; --j)
+        {
+          auto it = map.find(list->ObjectFromIndex(doc, j));
+          if (it == map.end()) continue;
+          const LONG flags = list->GetFlags(j);
+          list->DeleteObject(j);
+          list->InsertObject(it->second, flags);
+          listChanged = true;
+        }
+        if (!listChanged) break;
+        bc->SetData(id, copy);
+        changed = true;
+        break;
+      }
+    }
+  }
+  return changed;
+}
@@ -12,6 +12,8 @@
 #include <c4d.h>
 #include <c4d_legacy.h>
 #include <c4d_apibridge.h>
+#include <map>
+#include <set>
 
 #if API_VERSION < 15000
 namespace maxon {
@@ -19,6 +21,18 @@ namespace maxon {
 }
 #endif
 
+/// ***************************************************************************
+/// Returns the NodeData of *node* cast to *T*.
+/// ***************************************************************************
+template <typename T>
+static inline T* GetNodeData(GeListNode* node) {
+  #if API_VERSION >= 17000
+    return node->GetNodeData<T>();
+  #else
+    return static_cast<T*>(node->GetNodeData());
+  #endif
+}
+
 /// ***************************************************************************
 /// Hashes a Cinema 4D string and returns a number as a string.
 /// ***************************************************************************
@@ -80,6 +94,29 @@ T* GetNextNode(T* op, T const* origin=nullptr, Bool allowDepthwalk=true)
   return nullptr;
 }
 
+/// ***************************************************************************
+/// Returns the sum of the dirty counts of all objects below *root* for
+/// the specified *flags*, including their tags when *tags* is true. The
+/// sum changes whenever any of the objects changes, which makes it a
+/// cheap checksum for caches that depend on the hierarchy.
+/// ***************************************************************************
+inline UInt32 GetHierarchyDirty(BaseObject* root, DIRTYFLAGS flags, Bool tags=false)
+{
+  UInt32 sum = 0;
+  UInt32 count = 0;
+  for (BaseObject* op = root->GetDown(); op; op = GetNextNode(op, root))
+  {
+    sum += op->GetDirty(flags);
+    ++count;
+    if (tags)
+    {
+      for (BaseTag* tag = op->GetFirstTag(); tag; tag = tag->GetNext())
+        sum += tag->GetDirty(DIRTYFLAGS_DATA);
+    }
+  }
+  return sum * 31 + count;
+}
+
 /// ***************************************************************************
 /// RAII based automatic undo encapsulation for BaseDocument::StartUndo()
 /// and BaseDocument::EndUndo().
@@ -162,3 +199,26 @@ Bool PasswordDialog(String* out, Bool singleField=false, Bool allowEmpty=false);
 /// ***************************************************************************
 Bool FindMenuResource(const String& name, const String& subtitle, BaseContainer** bc);
 Bool FindMenuResource(BaseContainer& menu, const String& subtitle, BaseContainer** bc);
+
+/// ***************************************************************************
+/// Like #FindMenuResource(), but remembers the index path to the submenu
+/// in the world plugin container \p cacheId and tries that path first.
+/// The recursive search only runs if the cached path no longer matches.
+/// ***************************************************************************
+Bool FindMenuResourceCached(const String& name, const String& subtitle, LONG cacheId, BaseContainer** bc);
+
+/// ***************************************************************************
+/// Adds all nodes linked from *bc* and its sub-containers to *refs*,
+/// including the objects of InExclude lists.
+/// ***************************************************************************
+void CollectLinks(const BaseContainer* bc, BaseDocument* doc, std::set<BaseList2D*>& refs);
+
+/// Maps nodes to the nodes that links to them are redirected to.
+typedef std::map<BaseList2D*, BaseList2D*> LinkMap;
+
+/// ***************************************************************************
+/// Redirects the links in *bc* and its sub-containers, including the
+/// objects of InExclude lists, to the nodes that *map* assigns to their
+/// targets. Links are resolved in *doc*. Returns true if anything changed.
+/// ***************************************************************************
+Bool TranslateLinks(BaseContainer* bc, BaseDocument* doc, const LinkMap& map);
@@ -0,0 +1,238 @@
+/// Copyright (C) 2013-2015, Niklas Rosenstein
+/// All rights reserved.
+///
+/// Licensed under the GNU Lesser General Public License.
+///
+/// \file Utils/MotionBounds.cpp
+
+#include "MotionBounds.h"
+#include "Misc.h"
+#include "Trace.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+/// ***************************************************************************
+/// Mixes the bytes of *value* into the FNV-1a hash *h*.
+/// ***************************************************************************
+template <typename T>
+static void HashValue(UInt64& h, const T& value)
+{
+  unsigned char bytes[sizeof(T)];
+  std::memcpy(bytes, &value, sizeof(T));
+  for (unsigned char b : bytes)
+  {
+    h ^= b;
+    h *= 1099511628211ULL;
+  }
+}
+
+/// ***************************************************************************
+/// Returns the sum of the dirty counts of the tracks of *node*.
+/// ***************************************************************************
+static UInt32 GetTracksDirty(BaseList2D* node)
+{
+  UInt32 sum = 0;
+  for (CTrack* track = node->GetFirstCTrack(); track; track = track->GetNext())
+    sum = sum * 31 + track->GetDirty(DIRTYFLAGS_DATA) + 1;
+  return sum;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+void MotionBoundsCache::Flush()
+{
+  m_samples.clear();
+  m_tracks.clear();
+  m_hasTracks = false;
+  m_dataDirty = 0;
+  m_trackDirty = 0;
+  m_frame = 0;
+  m_fps = 0;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+void MotionBoundsCache::CollectTracks(BaseObject* root, TrackMap& out)
+{
+  auto collect = [&out](BaseList2D* node) {
+    for (CTrack* track = node->GetFirstCTrack(); track; track = track->GetNext())
+    {
+      TrackState& state = out[track];
+      state.dirty = track->GetDirty(DIRTYFLAGS_DATA);
+      CCurve* curve = track->GetCurve();
+      const LONG count = curve ? curve->GetKeyCount() : 0;
+      state.keys.resize(count);
+      for (LONG i = 0; i < count; ++i)
+      {
+        const CKey* key = curve->GetKey(i);
+        UInt64 h = 14695981039346656037ULL;
+        HashValue(h, (Int32) key->GetInterpolation());
+        HashValue(h, key->GetValue());
+        HashValue(h, key->GetValueLeft());
+        HashValue(h, key->GetValueRight());
+        HashValue(h, key->GetTimeLeft().Get());
+        HashValue(h, key->GetTimeRight().Get());
+        state.keys[i].time = key->GetTime().Get();
+        state.keys[i].hash = h;
+      }
+    }
+  };
+  for (BaseObject* op = root->GetDown(); op; op = GetNextNode(op, root))
+  {
+    collect(op);
+    for (BaseTag* tag = op->GetFirstTag(); tag; tag = tag->GetNext())
+      collect(tag);
+  }
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+Bool MotionBoundsCache::InvalidateMissing(const std::vector<KeyState>& keys,
+  const std::vector<KeyState>& other)
+{
+  Bool found = false;
+  for (size_t i = 0; i < keys.size(); ++i)
+  {
+    if (std::find(other.begin(), other.end(), keys[i]) != other.end()) continue;
+    found = true;
+
+    // A key shapes the curve up to its neighbours, the first and last
+    // key also define the value before and after the curve.
+    const LONG from = i > 0 ? (LONG) std::floor(keys[i - 1].time * m_fps)
+      : std::numeric_limits<LONG>::min();
+    const LONG to = i + 1 < keys.size() ? (LONG) std::ceil(keys[i + 1].time * m_fps)
+      : std::numeric_limits<LONG>::max();
+    Invalidate(from, to);
+  }
+  return found;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+Bool MotionBoundsCache::InvalidateKeys(const TrackState& before, const TrackState& after)
+{
+  const Bool removed = InvalidateMissing(before.keys, after.keys);
+  const Bool added = InvalidateMissing(after.keys, before.keys);
+  return removed || added;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+void MotionBoundsCache::Validate(BaseObject* root, LONG frame, LONG fps)
+{
+  TRACE_SCOPE("MotionBoundsCache::Validate");
+  if (fps != m_fps)
+  {
+    Flush();
+    m_fps = fps;
+  }
+
+  UInt32 trackDirty = 0;
+  for (BaseObject* op = root->GetDown(); op; op = GetNextNode(op, root))
+  {
+    trackDirty = trackDirty * 31 + GetTracksDirty(op);
+    for (BaseTag* tag = op->GetFirstTag(); tag; tag = tag->GetNext())
+      trackDirty = trackDirty * 31 + GetTracksDirty(tag);
+  }
+  const UInt32 dataDirty = GetHierarchyDirty(root, DIRTYFLAGS_DATA | DIRTYFLAGS_MATRIX, true);
+
+  if (trackDirty != m_trackDirty || !m_hasTracks)
+  {
+    TrackMap tracks;
+    CollectTracks(root, tracks);
+    if (!m_samples.empty())
+    {
+      // Tracks that were added or removed and changes that are not
+      // reflected in the keys (eg. the track's loop settings) affect
+      // the whole timeline.
+      Bool narrowed = tracks.size() == m_tracks.size();
+      for (auto it = tracks.begin(); narrowed && it != tracks.end(); ++it)
+      {
+        auto prev = m_tracks.find(it->first);
+        if (prev == m_tracks.end())
+          narrowed = false;
+        else if (prev->second.dirty != it->second.dirty)
+          narrowed = InvalidateKeys(prev->second, it->second);
+      }
+      if (!narrowed)
+        m_samples.clear();
+    }
+    m_tracks.swap(tracks);
+    m_trackDirty = trackDirty;
+    m_hasTracks = true;
+  }
+  else if (dataDirty != m_dataDirty && frame == m_frame)
+    m_samples.clear();
+
+  m_dataDirty = dataDirty;
+  m_frame = frame;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+Bool MotionBoundsCache::Lookup(LONG frame, Vector* mp, Vector* rad) const
+{
+  auto it = m_samples.find(frame);
+  if (it == m_samples.end()) return false;
+  *mp = it->second.mp;
+  *rad = it->second.rad;
+  return true;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+void MotionBoundsCache::Store(LONG frame, const Vector& mp, const Vector& rad)
+{
+  Sample& sample = m_samples[frame];
+  sample.mp = mp;
+  sample.rad = rad;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+void MotionBoundsCache::Invalidate(LONG from, LONG to)
+{
+  if (from > to) return;
+  m_samples.erase(m_samples.lower_bound(from), m_samples.upper_bound(to));
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+Bool MotionBoundsCache::GetUnion(LONG from, LONG to, Vector* mp, Vector* rad) const
+{
+  Vector bbmin, bbmax;
+  LONG count = 0;
+  for (auto it = m_samples.lower_bound(from); it != m_samples.end() && it->first <= to; ++it)
+  {
+    const Vector lo = it->second.mp - it->second.rad;
+    const Vector hi = it->second.mp + it->second.rad;
+    if (count++ == 0)
+    {
+      bbmin = lo;
+      bbmax = hi;
+      continue;
+    }
+    bbmin = Vector(Min(bbmin.x, lo.x), Min(bbmin.y, lo.y), Min(bbmin.z, lo.z));
+    bbmax = Vector(Max(bbmax.x, hi.x), Max(bbmax.y, hi.y), Max(bbmax.z, hi.z));
+  }
+  if (count == 0)
+  {
+    *mp = *rad = Vector(0.0);
+    return false;
+  }
+  *mp = (bbmin + bbmax) * 0.5;
+  *rad = (bbmax - bbmin) * 0.5;
+  return count == to - from + 1;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+Int64 MotionBoundsCache::GetMemorySize() const
+{
+  Int64 bytes = (Int64) m_samples.size() * (sizeof(Sample) + 4 * sizeof(void*));
+  for (const auto& track : m_tracks)
+    bytes += sizeof(TrackState) + track.second.keys.size() * sizeof(KeyState);
+  return bytes;
+}
@@ -0,0 +1,100 @@
+/// Copyright (C) 2013-2015, Niklas Rosenstein
+/// All rights reserved.
+///
+/// Licensed under the GNU Lesser General Public License.
+///
+/// \file Utils/MotionBounds.h
+
+#pragma once
+
+#include <c4d.h>
+#include <c4d_legacy.h>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+/// ***************************************************************************
+/// Bounding boxes of a hierarchy keyed by frame. #Validate() must be
+/// called before each lookup: it compares the animation tracks below the
+/// root with the state of the last call and drops the frames that the
+/// changed keys can affect. Any other change of the hierarchy while the
+/// frame stays the same (an edit in the Attribute Manager) drops all
+/// frames, since it can not be told apart from the result of animation.
+/// ***************************************************************************
+class MotionBoundsCache
+{
+public:
+
+  MotionBoundsCache() : m_hasTracks(false), m_dataDirty(0), m_trackDirty(0), m_frame(0), m_fps(0) { }
+
+  /// Frees all samples and the track snapshot.
+  void Flush();
+
+  /// Drops the samples affected by changes below *root* since the last
+  /// call. *frame* is the current frame of the document at *fps*.
+  void Validate(BaseObject* root, LONG frame, LONG fps);
+
+  /// Returns true and fills *mp* and *rad* if *frame* is cached.
+  Bool Lookup(LONG frame, Vector* mp, Vector* rad) const;
+
+  /// Stores the bounding box for *frame*.
+  void Store(LONG frame, const Vector& mp, const Vector& rad);
+
+  /// Drops the samples from *from* to *to* (inclusive).
+  void Invalidate(LONG from, LONG to);
+
+  /// Computes the union of the samples from *from* to *to* (inclusive).
+  /// Returns false if not all frames of the range are cached, the union
+  /// of the available ones is returned anyway.
+  Bool GetUnion(LONG from, LONG to, Vector* mp, Vector* rad) const;
+
+  /// Returns the number of cached frames.
+  LONG GetCount() const { return (LONG) m_samples.size(); }
+
+  /// Returns the approximate number of bytes held by the cache.
+  Int64 GetMemorySize() const;
+
+private:
+
+  struct Sample
+  {
+    Vector mp;
+    Vector rad;
+  };
+
+  struct KeyState
+  {
+    Float time;
+    UInt64 hash;
+    Bool operator == (const KeyState& other) const
+      { return time == other.time && hash == other.hash; }
+  };
+
+  struct TrackState
+  {
+    UInt32 dirty;
+    std::vector<KeyState> keys;
+  };
+
+  typedef std::unordered_map<CTrack*, TrackState> TrackMap;
+
+  /// Collects the tracks of the objects and tags below *root*.
+  static void CollectTracks(BaseObject* root, TrackMap& out);
+
+  /// Drops the frames between the neighbours of the keys that differ
+  /// between *before* and *after*. Returns false if the change could
+  /// not be narrowed down.
+  Bool InvalidateKeys(const TrackState& before, const TrackState& after);
+
+  /// Drops the frames between the neighbours of the keys in *keys*
+  /// that are not in *other*.
+  Bool InvalidateMissing(const std::vector<KeyState>& keys, const std::vector<KeyState>& other);
+
+  std::map<LONG, Sample> m_samples;
+  TrackMap m_tracks;
+  Bool m_hasTracks;
+  UInt32 m_dataDirty;
+  UInt32 m_trackDirty;
+  LONG m_frame;
+  LONG m_fps;
+};
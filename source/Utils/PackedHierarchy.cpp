@@ -0,0 +1,263 @@
+/// Copyright (C) 2013-2015, Niklas Rosenstein
+/// All rights reserved.
+///
+/// Licensed under the GNU Lesser General Public License.
+///
+/// \file Utils/PackedHierarchy.cpp
+
+#include "PackedHierarchy.h"
+#include "Compression.h"
+#include "Misc.h"
+#include "Trace.h"
+#include <set>
+
+/// ***************************************************************************
+/// Returns the bytes of the marker of *node*.
+/// ***************************************************************************
+static std::vector<Char> GetMarkerBytes(BaseList2D* node)
+{
+  void* data = nullptr;
+  Int32 size = 0;
+  node->GetMarker().GetMemory(data, size);
+  if (!data || size <= 0) return std::vector<Char>();
+  return std::vector<Char>((Char*) data, (Char*) data + size);
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+static Bool ReadBytes(HyperFile* hf, std::vector<Char>& bytes)
+{
+  void* data = nullptr;
+  Int size = 0;
+  if (!hf->ReadMemory(&data, &size)) return false;
+  bytes.assign((Char*) data, (Char*) data + (data ? size : 0));
+  DeleteMem(data);
+  return true;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+void PackedHierarchy::Flush()
+{
+  m_materials.clear();
+  m_data.reset();
+  m_rawSize = 0;
+  m_objects = 0;
+  m_mp = m_rad = Vector(0.0);
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+Bool PackedHierarchy::Store(BaseObject* root)
+{
+  TRACE_SCOPE("PackedHierarchy::Store");
+  Flush();
+  if (!root) return false;
+  BaseDocument* doc = root->GetDocument();
+
+  std::set<BaseMaterial*> materials;
+  LONG objects = 0;
+  for (NodeIterator<BaseObject> it(root->GetDown(), root); it; ++it)
+  {
+    ++objects;
+    for (BaseTag* tag = it->GetFirstTag(); tag; tag = tag->GetNext())
+    {
+      if (tag->GetType() != Ttexture) continue;
+      BaseMaterial* mat = static_cast<TextureTag*>(tag)->GetMaterial();
+      if (mat) materials.insert(mat);
+    }
+  }
+
+  // Clone everything at once so that links between the clones are kept.
+  BaseDocument* tmp = BaseDocument::Alloc();
+  AutoAlloc<AliasTrans> at;
+  AutoAlloc<MemoryFileStruct> mfs;
+  std::vector<MaterialIdentity> identities;
+  Bool ok = false;
+  if (tmp && at && mfs && at->Init(doc))
+  {
+    BaseObject* pred = nullptr;
+    for (BaseObject* child = root->GetDown(); child; child = child->GetNext())
+    {
+      BaseObject* clone = static_cast<BaseObject*>(child->GetClone(COPYFLAGS_0, at));
+      if (!clone) continue;
+      tmp->InsertObject(clone, nullptr, pred);
+      pred = clone;
+    }
+    for (BaseMaterial* mat : materials)
+    {
+      BaseMaterial* clone = static_cast<BaseMaterial*>(mat->GetClone(COPYFLAGS_0, at));
+      if (!clone) continue;
+      tmp->InsertMaterial(clone);
+      MaterialIdentity identity;
+      identity.packed = GetMarkerBytes(clone);
+      identity.original = GetMarkerBytes(mat);
+      identities.push_back(identity);
+    }
+    at->Translate(true);
+
+    Filename fn;
+    fn.SetMemoryWriteMode(mfs);
+    if (SaveDocument(tmp, fn, SAVEDOCUMENTFLAGS_DONTADDTORECENTLIST, FORMAT_C4DEXPORT))
+    {
+      void* data = nullptr;
+      Int size = 0;
+      mfs->GetData(data, size, false);
+      maxon::BaseArray<maxon::Char> packed;
+      iferr (Compress(maxon::ToBlock<const maxon::Char>((const maxon::Char*) data, size), packed))
+        packed.Reset();
+      if (data && !packed.IsEmpty())
+      {
+        m_data = std::make_shared<const std::vector<Char>>(packed.Begin(), packed.End());
+        m_rawSize = size;
+        m_objects = objects;
+        m_materials.swap(identities);
+        ok = true;
+      }
+    }
+  }
+  BaseDocument::Free(tmp);
+  return ok;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+Bool PackedHierarchy::Restore(BaseObject* root, BaseDocument* doc, Bool undo) const
+{
+  TRACE_SCOPE("PackedHierarchy::Restore");
+  if (!root || IsEmpty()) return false;
+
+  maxon::BaseArray<maxon::Char> scene;
+  iferr (Decompress(maxon::ToBlock<const maxon::Char>(m_data->data(), m_data->size()), scene))
+    return false;
+  Filename fn;
+  fn.SetMemoryReadMode(scene.GetFirst(), scene.GetCount());
+  BaseDocument* loaded = LoadDocument(fn, SCENEFILTER_OBJECTS | SCENEFILTER_MATERIALS, nullptr);
+  if (!loaded) return false;
+
+  // Materials that are still in the document (because they are used
+  // elsewhere) replace their stored copies, in every link to them.
+  LinkMap replaced;
+  for (BaseMaterial* mat = loaded->GetFirstMaterial(); doc && mat; mat = mat->GetNext())
+  {
+    const std::vector<Char>* original = FindOriginal(mat);
+    if (!original) continue;
+    for (BaseMaterial* existing = doc->GetFirstMaterial(); existing; existing = existing->GetNext())
+    {
+      if (GetMarkerBytes(existing) == *original)
+      {
+        replaced[mat] = existing;
+        break;
+      }
+    }
+  }
+  if (!replaced.empty())
+  {
+    for (BaseObject* op = loaded->GetFirstObject(); op; op = GetNextNode(op))
+    {
+      TranslateLinks(op->GetDataInstance(), loaded, replaced);
+      for (BaseTag* tag = op->GetFirstTag(); tag; tag = tag->GetNext())
+        TranslateLinks(tag->GetDataInstance(), loaded, replaced);
+    }
+    for (BaseMaterial* mat = loaded->GetFirstMaterial(); mat; mat = mat->GetNext())
+      TranslateLinks(mat->GetDataInstance(), loaded, replaced);
+  }
+
+  while (BaseMaterial* mat = loaded->GetFirstMaterial())
+  {
+    mat->Remove();
+    if (!doc || replaced.count(mat))
+    {
+      BaseMaterial::Free(mat);
+      continue;
+    }
+    doc->InsertMaterial(mat);
+    if (undo) doc->AddUndo(UNDOTYPE_NEW, mat);
+  }
+
+  while (BaseObject* op = loaded->GetFirstObject())
+  {
+    op->Remove();
+    op->InsertUnderLast(root);
+    if (doc && undo) doc->AddUndo(UNDOTYPE_NEW, op);
+  }
+  BaseDocument::Free(loaded);
+  return true;
+}
+
+/// ***************************************************************************
+/// Returns the marker of the material that the stored material *packed*
+/// was copied from, or nullptr if it is not known.
+/// ***************************************************************************
+const std::vector<Char>* PackedHierarchy::FindOriginal(BaseMaterial* packed) const
+{
+  const std::vector<Char> marker = GetMarkerBytes(packed);
+  if (marker.empty()) return nullptr;
+  for (const MaterialIdentity& identity : m_materials)
+  {
+    if (identity.packed == marker && !identity.original.empty())
+      return &identity.original;
+  }
+  return nullptr;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+Bool PackedHierarchy::Read(HyperFile* hf)
+{
+  Flush();
+  void* data = nullptr;
+  Int size = 0;
+  Int32 objects = 0;
+  if (!hf->ReadInt64(&m_rawSize)) return false;
+  if (!hf->ReadInt32(&objects)) return false;
+  if (!hf->ReadVector(&m_mp)) return false;
+  if (!hf->ReadVector(&m_rad)) return false;
+  if (!hf->ReadMemory(&data, &size)) return false;
+  m_objects = objects;
+  if (data)
+  {
+    m_data = std::make_shared<const std::vector<Char>>((Char*) data, (Char*) data + size);
+    DeleteMem(data);
+  }
+  Int32 materials = 0;
+  if (!hf->ReadInt32(&materials)) return false;
+  for (Int32 i = 0; i < materials; ++i)
+  {
+    MaterialIdentity identity;
+    if (!ReadBytes(hf, identity.packed)) return false;
+    if (!ReadBytes(hf, identity.original)) return false;
+    m_materials.push_back(identity);
+  }
+  return true;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+Bool PackedHierarchy::Write(HyperFile* hf) const
+{
+  if (!hf->WriteInt64(m_rawSize)) return false;
+  if (!hf->WriteInt32(m_objects)) return false;
+  if (!hf->WriteVector(m_mp)) return false;
+  if (!hf->WriteVector(m_rad)) return false;
+  if (!hf->WriteMemory(m_data ? m_data->data() : nullptr, m_data ? m_data->size() : 0)) return false;
+  if (!hf->WriteInt32((Int32) m_materials.size())) return false;
+  for (const MaterialIdentity& identity : m_materials)
+  {
+    if (!hf->WriteMemory(identity.packed.data(), identity.packed.size())) return false;
+    if (!hf->WriteMemory(identity.original.data(), identity.original.size())) return false;
+  }
+  return true;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+void PackedHierarchy::CopyTo(PackedHierarchy& dest) const
+{
+  dest.m_materials = m_materials;
+  dest.m_data = m_data;
+  dest.m_rawSize = m_rawSize;
+  dest.m_objects = m_objects;
+  dest.m_mp = m_mp;
+  dest.m_rad = m_rad;
+}
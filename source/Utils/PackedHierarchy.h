@@ -0,0 +1,77 @@
+/// Copyright (C) 2013-2015, Niklas Rosenstein
+/// All rights reserved.
+///
+/// Licensed under the GNU Lesser General Public License.
+///
+/// \file Utils/PackedHierarchy.h
+
+#pragma once
+
+#include <c4d.h>
+#include <c4d_legacy.h>
+#include <memory>
+#include <vector>
+
+/// ***************************************************************************
+/// The children of an object with their tags and the materials they use,
+/// saved as a compressed scene. The data is shared between copies, so
+/// copying a packed object (eg. for undo) does not copy the blob.
+/// ***************************************************************************
+class PackedHierarchy
+{
+public:
+
+  PackedHierarchy() : m_rawSize(0), m_objects(0), m_mp(0.0), m_rad(0.0) { }
+
+  /// Frees all data.
+  void Flush();
+
+  /// Returns true if nothing is stored.
+  Bool IsEmpty() const { return !m_data || m_data->empty(); }
+
+  /// Serializes the children of *root* and the materials of their
+  /// texture tags. The hierarchy is not modified.
+  Bool Store(BaseObject* root);
+
+  /// Inserts the stored objects under *root* and the materials into
+  /// *doc*. A material that is still in *doc* (the one it was stored
+  /// from, identified by its marker) is used instead of the stored copy
+  /// and all links to the copy are redirected to it. Undos are added to
+  /// *doc* if *undo* is true.
+  Bool Restore(BaseObject* root, BaseDocument* doc, Bool undo) const;
+
+  /// The bounding box of the children when they were stored, in the
+  /// space of the root object.
+  void SetBounds(const Vector& mp, const Vector& rad) { m_mp = mp; m_rad = rad; }
+  void GetBounds(Vector* mp, Vector* rad) const { *mp = m_mp; *rad = m_rad; }
+
+  /// Returns the number of stored objects.
+  LONG GetObjectCount() const { return m_objects; }
+
+  /// Returns the compressed and uncompressed size in bytes.
+  Int64 GetMemorySize() const { return m_data ? (Int64) m_data->size() : 0; }
+  Int64 GetRawSize() const { return m_rawSize; }
+
+  Bool Read(HyperFile* hf);
+  Bool Write(HyperFile* hf) const;
+  void CopyTo(PackedHierarchy& dest) const;
+
+private:
+
+  /// The marker of a stored material and of the material it was copied
+  /// from, as returned by GeMarker::GetMemory().
+  struct MaterialIdentity
+  {
+    std::vector<Char> packed;
+    std::vector<Char> original;
+  };
+
+  const std::vector<Char>* FindOriginal(BaseMaterial* packed) const;
+
+  std::vector<MaterialIdentity> m_materials;
+  std::shared_ptr<const std::vector<Char>> m_data;
+  Int64 m_rawSize;
+  LONG m_objects;
+  Vector m_mp;
+  Vector m_rad;
+};
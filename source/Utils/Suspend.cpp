@@ -0,0 +1,123 @@
+/// Copyright (C) 2013-2015, Niklas Rosenstein
+/// All rights reserved.
+///
+/// Licensed under the GNU Lesser General Public License.
+///
+/// \file Utils/Suspend.cpp
+
+#include "Suspend.h"
+#include "Misc.h"
+#include <texpression.h>
+
+/// ***************************************************************************
+/// ***************************************************************************
+LONG GetSuspendReasons(BaseList2D* node)
+{
+  const BaseContainer* bc = node ? node->GetDataInstance() : nullptr;
+  if (!bc) return 0;
+  const BaseContainer* state = bc->GetContainerInstance(CONTAINEROBJECT_SUSPENDSTATE);
+  return state ? state->GetInt32(SUSPENDSTATE_REASONS) : 0;
+}
+
+/// ***************************************************************************
+/// Saves the execution state of *node* to *state* and disables it.
+/// ***************************************************************************
+static void Disable(BaseList2D* node, BaseContainer& state)
+{
+  if (node->IsInstanceOf(Obase))
+  {
+    BaseObject* op = static_cast<BaseObject*>(node);
+    state.SetInt32(SUSPENDSTATE_EDITORMODE, op->GetEditorMode());
+    state.SetInt32(SUSPENDSTATE_RENDERMODE, op->GetRenderMode());
+    state.SetBool(SUSPENDSTATE_DEFORMMODE, op->GetDeformMode());
+    op->SetEditorMode(MODE_OFF);
+    op->SetRenderMode(MODE_OFF);
+    op->SetDeformMode(false);
+  }
+  else if (node->IsInstanceOf(Tbase) && (static_cast<BaseTag*>(node)->GetInfo() & TAG_EXPRESSION))
+  {
+    GeData data;
+    node->GetParameter(EXPRESSION_ENABLE, data, DESCFLAGS_GET_0);
+    state.SetBool(SUSPENDSTATE_EXPRESSION, data.GetBool());
+    node->SetParameter(EXPRESSION_ENABLE, GeData(false), DESCFLAGS_SET_0);
+  }
+}
+
+/// ***************************************************************************
+/// Restores the execution state of *node* from *state*.
+/// ***************************************************************************
+static void Restore(BaseList2D* node, const BaseContainer& state)
+{
+  if (node->IsInstanceOf(Obase))
+  {
+    BaseObject* op = static_cast<BaseObject*>(node);
+    op->SetEditorMode(state.GetInt32(SUSPENDSTATE_EDITORMODE, MODE_UNDEF));
+    op->SetRenderMode(state.GetInt32(SUSPENDSTATE_RENDERMODE, MODE_UNDEF));
+    op->SetDeformMode(state.GetBool(SUSPENDSTATE_DEFORMMODE, true));
+  }
+  else if (state.GetDataPointer(SUSPENDSTATE_EXPRESSION))
+  {
+    node->SetParameter(EXPRESSION_ENABLE, GeData(state.GetBool(SUSPENDSTATE_EXPRESSION)), DESCFLAGS_SET_0);
+  }
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+Bool SuspendNode(BaseList2D* node, LONG reason, Bool suspend, BaseDocument* doc)
+{
+  BaseContainer* bc = node ? node->GetDataInstance() : nullptr;
+  if (!bc) return false;
+
+  const LONG reasons = GetSuspendReasons(node);
+  const LONG newReasons = suspend ? (reasons | reason) : (reasons & ~reason);
+  if (newReasons == reasons) return false;
+
+  if (doc)
+    doc->AddUndo(UNDOTYPE_CHANGE_SMALL, node);
+
+  if (reasons == 0)
+  {
+    // First reason, save the state and take the node out of execution.
+    BaseContainer state;
+    Disable(node, state);
+    state.SetInt32(SUSPENDSTATE_REASONS, newReasons);
+    bc->SetContainer(CONTAINEROBJECT_SUSPENDSTATE, state);
+    return true;
+  }
+
+  if (newReasons == 0)
+  {
+    // Last reason cleared, restore the original state.
+    BaseContainer state = bc->GetContainer(CONTAINEROBJECT_SUSPENDSTATE);
+    bc->RemoveData(CONTAINEROBJECT_SUSPENDSTATE);
+    Restore(node, state);
+    return true;
+  }
+
+  BaseContainer* state = bc->GetContainerInstance(CONTAINEROBJECT_SUSPENDSTATE);
+  if (state)
+    state->SetInt32(SUSPENDSTATE_REASONS, newReasons);
+  return false;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+static void SuspendTags(BaseObject* op, LONG reason, Bool suspend, BaseDocument* doc)
+{
+  for (BaseTag* tag = op->GetFirstTag(); tag; tag = tag->GetNext())
+    SuspendNode(tag, reason, suspend, doc);
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+void SuspendHierarchy(BaseObject* op, LONG reason, Bool suspend, BaseDocument* doc)
+{
+  if (!op) return;
+  SuspendNode(op, reason, suspend, doc);
+  SuspendTags(op, reason, suspend, doc);
+  for (BaseObject* child = op->GetDown(); child; child = GetNextNode(child, op))
+  {
+    SuspendNode(child, reason, suspend, doc);
+    SuspendTags(child, reason, suspend, doc);
+  }
+}
@@ -0,0 +1,56 @@
+/// Copyright (C) 2013-2015, Niklas Rosenstein
+/// All rights reserved.
+///
+/// Licensed under the GNU Lesser General Public License.
+///
+/// \file Utils/Suspend.h
+///
+/// Suspending a node takes it out of scene execution: objects are
+/// hidden in the editor and renderer and their generator/deformer is
+/// disabled, expression tags are disabled. The original state is kept
+/// in a sub-container of the node (#CONTAINEROBJECT_SUSPENDSTATE), so
+/// it survives saving and copying. A node can be suspended for several
+/// reasons at once and is only restored when the last one is cleared.
+
+#pragma once
+
+#include <c4d.h>
+#include <c4d_legacy.h>
+
+enum
+{
+  CONTAINEROBJECT_SUSPENDSTATE = 1039504,
+
+  SUSPENDSTATE_REASONS = 1000,
+  SUSPENDSTATE_EDITORMODE,
+  SUSPENDSTATE_RENDERMODE,
+  SUSPENDSTATE_DEFORMMODE,
+  SUSPENDSTATE_EXPRESSION,
+};
+
+/// Reasons for which a node can be suspended, combined as a bitmask.
+/// Levels of detail depend on the view and are not a reason, they are
+/// switched without changing the document.
+enum SUSPENDREASON
+{
+  SUSPENDREASON_FREEZE = (1 << 1),
+  SUSPENDREASON_USER = (1 << 2),
+};
+
+/// ***************************************************************************
+/// Suspends or resumes *node* for *reason*. Returns true if the
+/// execution state of the node changed. If *doc* is not \c nullptr,
+/// undos will be added.
+/// ***************************************************************************
+Bool SuspendNode(BaseList2D* node, LONG reason, Bool suspend, BaseDocument* doc);
+
+/// ***************************************************************************
+/// Suspends or resumes *op*, its tags and all of its children and their
+/// tags for *reason*.
+/// ***************************************************************************
+void SuspendHierarchy(BaseObject* op, LONG reason, Bool suspend, BaseDocument* doc);
+
+/// ***************************************************************************
+/// Returns the reasons *node* is suspended for, 0 if it is not suspended.
+/// ***************************************************************************
+LONG GetSuspendReasons(BaseList2D* node);
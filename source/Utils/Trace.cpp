@@ -0,0 +1,120 @@
+/// Copyright (C) 2013-2015, Niklas Rosenstein
+/// All rights reserved.
+///
+/// Licensed under the GNU Lesser General Public License.
+///
+/// \file Utils/Trace.cpp
+
+#include "Trace.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <thread>
+
+std::atomic<Bool> g_traceEnabled(false);
+
+/// ***************************************************************************
+/// A slot of the ring buffer, guarded like a seqlock. #sequence is zero
+/// while the slot is written and holds the index of the event plus one
+/// afterwards. A reader copies the fields and then reads #sequence again,
+/// the copy is only valid if it didn't change. The fields are atomics so
+/// that a reader racing with a writer is well defined.
+/// ***************************************************************************
+struct TraceEvent
+{
+  std::atomic<UInt64> sequence;
+  std::atomic<const char*> name;
+  std::atomic<Int64> timestamp;
+  std::atomic<UInt64> threadId;
+  std::atomic<char> phase;
+};
+
+static TraceEvent g_traceEvents[TRACE_CAPACITY];
+static std::atomic<UInt64> g_traceHead(0);
+static Filename g_traceFile;
+static const std::chrono::steady_clock::time_point g_traceEpoch = std::chrono::steady_clock::now();
+
+/// ***************************************************************************
+/// ***************************************************************************
+static UInt64 CurrentThreadId()
+{
+  static thread_local UInt64 id = std::hash<std::thread::id>()(std::this_thread::get_id()) & 0xffffffff;
+  return id;
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+void TraceInit()
+{
+  g_traceFile = GeGetStartupWritePath() + "nrcontainer-trace.json";
+  Bool enabled = false;
+
+  const char* env = getenv("NRCONTAINER_TRACE");
+  if (env && *env && strcmp(env, "0") != 0)
+  {
+    enabled = true;
+    if (strcmp(env, "1") != 0)
+      g_traceFile = Filename(String(env));
+  }
+
+  g_traceEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+void TraceRecord(const char* name, char phase)
+{
+  const UInt64 index = g_traceHead.fetch_add(1, std::memory_order_relaxed);
+  TraceEvent& event = g_traceEvents[index & (TRACE_CAPACITY - 1)];
+  event.sequence.store(0, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  event.name.store(name, std::memory_order_relaxed);
+  event.timestamp.store(std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - g_traceEpoch).count(), std::memory_order_relaxed);
+  event.threadId.store(CurrentThreadId(), std::memory_order_relaxed);
+  event.phase.store(phase, std::memory_order_relaxed);
+  event.sequence.store(index + 1, std::memory_order_release);
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+Bool TraceFlush(const Filename* fn)
+{
+  const UInt64 head = g_traceHead.load(std::memory_order_acquire);
+  const UInt64 first = (head > (UInt64) TRACE_CAPACITY) ? head - TRACE_CAPACITY : 0;
+
+  std::string json = "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n";
+  Bool separator = false;
+  char buf[256];
+  for (UInt64 index = first; index < head; ++index)
+  {
+    const TraceEvent& event = g_traceEvents[index & (TRACE_CAPACITY - 1)];
+    if (event.sequence.load(std::memory_order_acquire) != index + 1)
+      continue;  // Still being written or already overwritten.
+    const char* name = event.name.load(std::memory_order_relaxed);
+    const Int64 timestamp = event.timestamp.load(std::memory_order_relaxed);
+    const UInt64 threadId = event.threadId.load(std::memory_order_relaxed);
+    const char phase = event.phase.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (event.sequence.load(std::memory_order_relaxed) != index + 1)
+      continue;  // Overwritten while it was copied.
+    snprintf(buf, sizeof(buf),
+      "%s{\"name\": \"%s\", \"cat\": \"nrcontainer\", \"ph\": \"%c\", \"ts\": %lld, \"pid\": 1, \"tid\": %llu}",
+      separator ? ",\n" : "", name, phase,
+      (long long) timestamp, (unsigned long long) threadId);
+    json += buf;
+    separator = true;
+  }
+  json += "\n]}\n";
+
+  AutoAlloc<BaseFile> file;
+  if (!file || !file->Open(fn ? *fn : g_traceFile, FILEOPEN_WRITE, FILEDIALOG_NONE))
+    return false;
+  if (!file->WriteBytes(json.data(), json.size()))
+    return false;
+  GePrint("Container trace written to " + (fn ? *fn : g_traceFile).GetString());
+  return true;
+}
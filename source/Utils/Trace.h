@@ -0,0 +1,81 @@
+/// Copyright (C) 2013-2015, Niklas Rosenstein
+/// All rights reserved.
+///
+/// Licensed under the GNU Lesser General Public License.
+///
+/// \file Utils/Trace.h
+///
+/// Opt-in recording of scoped begin/end events that can be exported in
+/// the Chrome `trace_event` JSON format (loadable in Perfetto and
+/// chrome://tracing). Tracing is enabled with the `NRCONTAINER_TRACE`
+/// environment variable, there is no preference for it. When disabled, a
+/// #TraceScope costs a single branch.
+
+#pragma once
+
+#include <atomic>
+#include <c4d.h>
+#include <c4d_legacy.h>
+
+/// Number of events kept in the ring buffer. Older events are
+/// overwritten once the buffer is full.
+static const LONG TRACE_CAPACITY = 1 << 16;
+
+extern std::atomic<Bool> g_traceEnabled;
+
+/// ***************************************************************************
+/// Enables tracing if it was requested with the `NRCONTAINER_TRACE`
+/// environment variable. Called from PluginStart().
+/// ***************************************************************************
+void TraceInit();
+
+/// ***************************************************************************
+/// Returns true if events are being recorded.
+/// ***************************************************************************
+inline Bool TraceEnabled()
+{
+  return g_traceEnabled.load(std::memory_order_relaxed);
+}
+
+/// ***************************************************************************
+/// Records a single event. *name* must be a string literal, it is not
+/// copied. *phase* is the trace_event phase, `'B'` or `'E'`.
+/// ***************************************************************************
+void TraceRecord(const char* name, char phase);
+
+/// ***************************************************************************
+/// Writes all events currently in the buffer as Chrome trace_event JSON
+/// to *fn*, or to the path configured with `NRCONTAINER_TRACE` if *fn*
+/// is \c nullptr.
+/// ***************************************************************************
+Bool TraceFlush(const Filename* fn=nullptr);
+
+/// ***************************************************************************
+/// Records a begin event on construction and the matching end event
+/// on destruction.
+/// ***************************************************************************
+class TraceScope
+{
+  const char* m_name;
+
+public:
+
+  explicit TraceScope(const char* name) : m_name(nullptr)
+  {
+    if (TraceEnabled())
+    {
+      m_name = name;
+      TraceRecord(m_name, 'B');
+    }
+  }
+
+  ~TraceScope()
+  {
+    if (m_name)
+      TraceRecord(m_name, 'E');
+  }
+};
+
+#define TRACE_SCOPE_CONCAT2(a, b) a##b
+#define TRACE_SCOPE_CONCAT(a, b) TRACE_SCOPE_CONCAT2(a, b)
+#define TRACE_SCOPE(name) TraceScope TRACE_SCOPE_CONCAT(_traceScope, __LINE__)(name)
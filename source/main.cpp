@@ -9,17 +9,48 @@
 #include <c4d.h>
 #include <c4d_apibridge.h>
 #include <c4d_legacy.h>
+#include "Utils/Counters.h"
 #include "Utils/Misc.h"
+#include "Utils/Trace.h"
+#include "Utils/JobSystem.h"
+#include "ContainerObject.h"
 
 using c4d_apibridge::GlobalResource;
 
 extern Bool RegisterContainerObject(Bool prePass);
+extern Bool RegisterContainerRegistryHook();
 extern Bool RegisterCommands();
+extern Bool RegisterContainerLodTag();
+extern Bool RegisterContainerLibrary();
+extern Bool RegisterContainerProfiler();
+extern Bool RegisterContainerMemoryReport();
+#ifdef NRCONTAINER_BENCHMARK
+extern Bool RegisterBenchmark();
+extern void HandleBenchmarkArgs(C4DPL_CommandLineArgs* args);
+#endif
 
 Bool PluginStart()
 {
-  RegisterContainerObject(false);
-  RegisterCommands();
+  const Float start = GeGetMilliSeconds();
+  TraceInit();
+  {
+    TRACE_SCOPE("PluginStart");
+    JobSystemInit();
+    RegisterContainerRegistryHook();
+    RegisterContainerObject(false);
+    RegisterCommands();
+    RegisterContainerLodTag();
+    RegisterContainerLibrary();
+    RegisterContainerProfiler();
+    RegisterContainerMemoryReport();
+    #ifdef NRCONTAINER_BENCHMARK
+      RegisterBenchmark();
+    #endif
+  }
+  const Float elapsed = GeGetMilliSeconds() - start;
+  GlobalCounterAdd(PERFCOUNTER_STARTUP_MICROS, (Int64) (elapsed * 1000.0));
+  if (TraceEnabled())
+    GePrint("Container Object registered in " + RealToString(elapsed, -1, 2) + " ms");
   return false;
 }
 
@@ -30,8 +61,18 @@ Bool PluginMessage(LONG msgType, void* pData)
     case C4DPL_INIT_SYS:
       return GlobalResource().Init();
     case C4DPL_BUILDMENU:
+    {
+      TRACE_SCOPE("BuildMenu");
       RegisterContainerObject(true);
       break;
+    }
+    case CONTAINEROBJECT_MSG_FLUSHTRACE:
+      return TraceFlush();
+    #ifdef NRCONTAINER_BENCHMARK
+    case C4DPL_COMMANDLINEARGS:
+      HandleBenchmarkArgs(static_cast<C4DPL_CommandLineArgs*>(pData));
+      break;
+    #endif
     default:
       break;
   }
@@ -40,5 +81,8 @@ Bool PluginMessage(LONG msgType, void* pData)
 
 void PluginEnd()
 {
+  JobSystemShutdown();
+  if (TraceEnabled())
+    TraceFlush();
 }
 
@@ -0,0 +1,281 @@
+/// Copyright (C) 2013-2015, Niklas Rosenstein
+/// All rights reserved.
+///
+/// Licensed under the GNU Lesser General Public License.
+///
+/// \file tests/JobSystemTest.cpp
+///
+/// Standalone tests for Utils/JobSystem, built against the stand-ins in
+/// tests/stub by `make test`. Prints every failed check and exits with
+/// a non-zero status if any failed. A watchdog ends the run if the
+/// scheduler deadlocks.
+
+#include "JobSystem.h"
+#include "Trace.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <numeric>
+#include <thread>
+
+// Tracing is never enabled in the tests.
+std::atomic<Bool> g_traceEnabled(false);
+void TraceRecord(const char* name, char phase) { }
+
+static LONG g_failures = 0;
+
+#define CHECK(cond) \
+  do { \
+    if (!(cond)) { \
+      std::printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+      ++g_failures; \
+    } \
+  } while (0)
+
+/// ***************************************************************************
+/// Spins until *flag* is set, for at most a few seconds.
+/// ***************************************************************************
+static Bool WaitFor(const std::atomic<bool>& flag)
+{
+  for (LONG i = 0; i < 5000 && !flag.load(); ++i)
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  return flag.load();
+}
+
+/// ***************************************************************************
+/// Every index is visited exactly once, for any grain and range.
+/// ***************************************************************************
+static void TestParallelFor(JobSystem& sys)
+{
+  const LONG grains[] = {1, 7, 100, 100000};
+  for (LONG grain : grains)
+  {
+    std::vector<std::atomic<LONG>> visits(10000);
+    for (auto& v : visits) v.store(0);
+    ParallelFor(sys, 0, (LONG) visits.size(), grain, [&](LONG i) { visits[i].fetch_add(1); });
+    Bool once = true;
+    for (auto& v : visits) once = once && v.load() == 1;
+    CHECK(once);
+  }
+
+  std::atomic<LONG> sum(0);
+  ParallelFor(sys, 100, 200, 1, [&](LONG i) { sum.fetch_add(i); });
+  CHECK(sum.load() == 14950);
+
+  std::atomic<LONG> calls(0);
+  ParallelFor(sys, 5, 5, 1, [&](LONG) { calls.fetch_add(1); });
+  ParallelFor(sys, 5, 3, 1, [&](LONG) { calls.fetch_add(1); });
+  CHECK(calls.load() == 0);
+}
+
+/// ***************************************************************************
+/// The result matches the serial one and the chunks are combined in
+/// order, which a non-commutative reduction shows.
+/// ***************************************************************************
+static void TestParallelReduce(JobSystem& sys)
+{
+  const Int64 sum = ParallelReduce<Int64>(sys, 5, 100005, 16, 0,
+    [](LONG lo, LONG hi) {
+      Int64 r = 0;
+      for (LONG i = lo; i < hi; ++i) r += i;
+      return r;
+    },
+    [](Int64 a, Int64 b) { return a + b; });
+  CHECK(sum == (Int64) 100000 * 5 + (Int64) 100000 * 99999 / 2);
+
+  typedef std::vector<LONG> Indices;
+  const Indices order = ParallelReduce<Indices>(sys, 0, 5000, 3, Indices(),
+    [](LONG lo, LONG hi) {
+      Indices r(hi - lo);
+      std::iota(r.begin(), r.end(), lo);
+      return r;
+    },
+    [](Indices a, const Indices& b) {
+      a.insert(a.end(), b.begin(), b.end());
+      return a;
+    });
+  Indices expected(5000);
+  std::iota(expected.begin(), expected.end(), 0);
+  CHECK(order == expected);
+
+  CHECK(ParallelReduce<LONG>(sys, 3, 3, 1, 42,
+    [](LONG, LONG) { return 1; }, [](LONG a, LONG b) { return a + b; }) == 42);
+}
+
+/// ***************************************************************************
+/// Jobs that wait for their own groups finish, even with a single
+/// worker, since waiting threads run pending jobs.
+/// ***************************************************************************
+static void TestNestedWait(JobSystem& sys)
+{
+  std::atomic<LONG> count(0);
+  JobGroup outer(sys);
+  for (LONG i = 0; i < 16; ++i)
+  {
+    outer.Run([&]() {
+      JobGroup inner(sys);
+      for (LONG j = 0; j < 16; ++j)
+      {
+        inner.Run([&]() {
+          ParallelFor(sys, 0, 8, 1, [&](LONG) { count.fetch_add(1); });
+        });
+      }
+      inner.Wait();
+    });
+  }
+  outer.Wait();
+  CHECK(count.load() == 16 * 16 * 8);
+}
+
+/// ***************************************************************************
+/// Jobs that didn't start when the group is cancelled are skipped, the
+/// running ones see the cancellation. Every job blocks until released,
+/// so exactly one job per worker is running when the group is cancelled.
+/// ***************************************************************************
+static void TestCancel(JobSystem& sys)
+{
+  const LONG workers = sys.GetConcurrency() - 1;
+  std::atomic<bool> release(false), allStarted(false);
+  std::atomic<LONG> started(0), sawCancel(0);
+  JobGroup group(sys);
+  for (LONG i = 0; i < 1000; ++i)
+  {
+    group.Run([&]() {
+      if (started.fetch_add(1) + 1 == workers)
+        allStarted.store(true);
+      while (!release.load())
+        std::this_thread::yield();
+      if (group.IsCancelled())
+        sawCancel.fetch_add(1);
+    });
+  }
+
+  CHECK(WaitFor(allStarted));
+  group.Cancel();
+  release.store(true);
+  group.Wait();
+  CHECK(group.IsCancelled());
+  CHECK(started.load() == workers);
+  CHECK(sawCancel.load() == workers);
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+static void TestStartStop()
+{
+  JobSystem sys;
+  CHECK(sys.GetConcurrency() == 1);
+  CHECK(sys.Start(2));
+  CHECK(sys.GetConcurrency() == 3);
+
+  // Starting a running scheduler keeps its workers.
+  CHECK(sys.Start(5));
+  CHECK(sys.GetConcurrency() == 3);
+
+  sys.Stop();
+  CHECK(sys.GetConcurrency() == 1);
+  sys.Stop();
+  CHECK(sys.GetConcurrency() == 1);
+
+  // A stopped scheduler can be started again.
+  CHECK(sys.Start(1));
+  CHECK(sys.GetConcurrency() == 2);
+  TestParallelFor(sys);
+  sys.Stop();
+
+  // Pending jobs finish before the workers stop.
+  CHECK(sys.Start(2));
+  std::atomic<LONG> count(0);
+  {
+    JobGroup group(sys);
+    for (LONG i = 0; i < 100; ++i)
+      group.Run([&]() { count.fetch_add(1); });
+  }
+  sys.Stop();
+  CHECK(count.load() == 100);
+}
+
+/// ***************************************************************************
+/// Without workers every job runs on the calling thread.
+/// ***************************************************************************
+static void TestZeroWorkers()
+{
+  JobSystem sys;
+  CHECK(sys.Start(0));
+  CHECK(sys.GetConcurrency() == 1);
+
+  const std::thread::id self = std::this_thread::get_id();
+  std::atomic<LONG> foreign(0);
+  ParallelFor(sys, 0, 1000, 1, [&](LONG) {
+    if (std::this_thread::get_id() != self) foreign.fetch_add(1);
+  });
+  CHECK(foreign.load() == 0);
+
+  LONG count = 0;
+  JobGroup group(sys);
+  group.Run([&]() { ++count; });
+  CHECK(count == 1);
+  group.Cancel();
+  group.Run([&]() { ++count; });
+  group.Wait();
+  CHECK(count == 1);
+
+  TestParallelFor(sys);
+  TestParallelReduce(sys);
+  TestNestedWait(sys);
+  sys.Stop();
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+static void TestGlobal()
+{
+  CHECK(JobSystemGetConcurrency() == 1);
+  CHECK(JobSystemInit(2));
+  CHECK(JobSystemGetConcurrency() == 3);
+  std::atomic<LONG> sum(0);
+  ParallelFor(0, 100, 1, [&](LONG i) { sum.fetch_add(i); });
+  CHECK(sum.load() == 4950);
+  CHECK(ParallelReduce<LONG>(0, 100, 1, 0,
+    [](LONG lo, LONG hi) { return hi - lo; }, [](LONG a, LONG b) { return a + b; }) == 100);
+  JobSystemShutdown();
+  JobSystemShutdown();
+  CHECK(JobSystemGetConcurrency() == 1);
+}
+
+/// ***************************************************************************
+/// ***************************************************************************
+int main()
+{
+  std::thread([]() {
+    std::this_thread::sleep_for(std::chrono::seconds(60));
+    std::printf("JobSystemTest: timed out, the scheduler deadlocked.\n");
+    std::fflush(stdout);
+    std::_Exit(2);
+  }).detach();
+
+  TestStartStop();
+  TestZeroWorkers();
+  TestGlobal();
+
+  const LONG workerCounts[] = {1, 3, 8};
+  for (LONG workers : workerCounts)
+  {
+    JobSystem sys;
+    CHECK(sys.Start(workers));
+    TestParallelFor(sys);
+    TestParallelReduce(sys);
+    TestNestedWait(sys);
+    TestCancel(sys);
+    sys.Stop();
+  }
+
+  if (g_failures > 0)
+  {
+    std::printf("JobSystemTest: %d checks failed.\n", (int) g_failures);
+    return 1;
+  }
+  std::printf("JobSystemTest: all checks passed.\n");
+  return 0;
+}
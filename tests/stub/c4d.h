@@ -0,0 +1,66 @@
+/// Copyright (C) 2013-2015, Niklas Rosenstein
+/// All rights reserved.
+///
+/// Licensed under the GNU Lesser General Public License.
+///
+/// \file tests/stub/c4d.h
+///
+/// The parts of the Cinema 4D API that the standalone tests need, built
+/// on the standard library so that the tests run without Cinema 4D.
+/// C4DThread runs its Main() on a std::thread.
+
+#pragma once
+
+#include <cstdint>
+#include <thread>
+
+typedef int32_t LONG;
+typedef int32_t Int32;
+typedef int64_t Int64;
+typedef uint32_t UInt32;
+typedef uint64_t UInt64;
+typedef double Float;
+typedef bool Bool;
+typedef char Char;
+
+#define NOTOK (-1)
+
+#define gNew(T, ...) new T(__VA_ARGS__)
+#define gDelete(p) do { delete p; p = nullptr; } while (0)
+
+class Filename;
+
+enum THREADMODE { THREADMODE_ASYNC };
+enum THREADPRIORITY { THREADPRIORITY_NORMAL };
+
+/// Returns the number of threads Cinema 4D would use.
+inline LONG GeGetCurrentThreadCount()
+{
+  const unsigned count = std::thread::hardware_concurrency();
+  return count > 0 ? (LONG) count : 1;
+}
+
+class C4DThread
+{
+public:
+
+  virtual ~C4DThread() { }
+
+  virtual void Main() = 0;
+  virtual const Char* GetThreadName() = 0;
+
+  Bool Start(THREADMODE mode, THREADPRIORITY priority)
+  {
+    m_thread = std::thread([this]() { Main(); });
+    return true;
+  }
+
+  void Wait(Bool checkevents)
+  {
+    if (m_thread.joinable())
+      m_thread.join();
+  }
+
+private:
+  std::thread m_thread;
+};
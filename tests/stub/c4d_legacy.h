@@ -0,0 +1,12 @@
+/// Copyright (C) 2013-2015, Niklas Rosenstein
+/// All rights reserved.
+///
+/// Licensed under the GNU Lesser General Public License.
+///
+/// \file tests/stub/c4d_legacy.h
+///
+/// The legacy type names are part of the stub c4d.h.
+
+#pragma once
+
+#include "c4d.h"
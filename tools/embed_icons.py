@@ -0,0 +1,127 @@
+# Copyright (C) 2013-2015, Niklas Rosenstein
+# All rights reserved.
+#
+# Licensed under the GNU Lesser General Public License.
+"""
+Decodes the PNG icons in res/img and writes their RGBA pixels to
+source/Generated/EmbeddedIcons.cpp, so the plugin can register its icons
+without opening and decoding files at startup. Run `make icons` after
+changing an icon.
+"""
+
+import os
+import struct
+import sys
+import zlib
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+ICONS = [
+  ('ocontainer', 'res/img/ocontainer.png'),
+  ('null2container', 'res/img/null2container.png'),
+  ('container2null', 'res/img/container2null.png'),
+]
+HEADER = 'source/Generated/EmbeddedIcons.h'
+SOURCE = 'source/Generated/EmbeddedIcons.cpp'
+
+
+def paeth(a, b, c):
+  p = a + b - c
+  pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+  if pa <= pb and pa <= pc:
+    return a
+  return b if pb <= pc else c
+
+
+def read_png(filename):
+  """ Returns (width, height, rows) of an 8-bit RGBA, non-interlaced PNG. """
+
+  with open(filename, 'rb') as fp:
+    data = fp.read()
+  if data[:8] != b'\x89PNG\r\n\x1a\n':
+    raise ValueError('{}: not a PNG file'.format(filename))
+
+  offset, idat, header = 8, [], None
+  while offset < len(data):
+    length, kind = struct.unpack('>I4s', data[offset:offset + 8])
+    chunk = data[offset + 8:offset + 8 + length]
+    offset += 12 + length
+    if kind == b'IHDR':
+      header = struct.unpack('>IIBBBBB', chunk)
+    elif kind == b'IDAT':
+      idat.append(chunk)
+    elif kind == b'IEND':
+      break
+
+  width, height, depth, colortype, _, _, interlace = header
+  if depth != 8 or colortype != 6 or interlace != 0:
+    raise ValueError('{}: only 8-bit RGBA non-interlaced images are supported'.format(filename))
+
+  raw = zlib.decompress(b''.join(idat))
+  stride = width * 4
+  rows, prev = [], bytearray(stride)
+  for y in range(height):
+    start = y * (stride + 1)
+    ftype, line = raw[start], bytearray(raw[start + 1:start + 1 + stride])
+    for i in range(stride):
+      a = line[i - 4] if i >= 4 else 0
+      b = prev[i]
+      c = prev[i - 4] if i >= 4 else 0
+      if ftype == 1: line[i] = (line[i] + a) & 0xff
+      elif ftype == 2: line[i] = (line[i] + b) & 0xff
+      elif ftype == 3: line[i] = (line[i] + ((a + b) >> 1)) & 0xff
+      elif ftype == 4: line[i] = (line[i] + paeth(a, b, c)) & 0xff
+    rows.append(line)
+    prev = line
+  return width, height, rows
+
+
+def main():
+  header = [
+    '/// Generated by tools/embed_icons.py from res/img. Do not edit.',
+    '///',
+    '/// \\file Generated/EmbeddedIcons.h',
+    '',
+    '#pragma once',
+    '',
+    '#include "../Utils/EmbeddedIcon.h"',
+    '',
+    'namespace EmbeddedIcons {',
+    '',
+  ]
+  source = [
+    '/// Generated by tools/embed_icons.py from res/img. Do not edit.',
+    '///',
+    '/// \\file Generated/EmbeddedIcons.cpp',
+    '',
+    '#include "EmbeddedIcons.h"',
+    '',
+    'namespace EmbeddedIcons {',
+  ]
+  for name, path in ICONS:
+    width, height, rows = read_png(os.path.join(ROOT, path))
+    pixels = []
+    for row in rows:
+      for x in range(width):
+        r, g, b, a = row[x * 4:x * 4 + 4]
+        value = (r << 24) | (g << 16) | (b << 8) | a
+        pixels.append('0x{:08X}'.format(value) if value else '0')
+    header.append('extern const EmbeddedIcon {}; ///< {}'.format(name, path))
+    source.append('')
+    source.append('static constexpr UInt32 {}_pixels[{}] = {{'.format(name, width * height))
+    for i in range(0, len(pixels), 12):
+      source.append('  ' + ', '.join(pixels[i:i + 12]) + ',')
+    source.append('};')
+    source.append('constexpr EmbeddedIcon {0} = {{ {1}, {2}, {0}_pixels }};'.format(name, width, height))
+  for lines in (header, source):
+    lines.append('')
+    lines.append('} // namespace EmbeddedIcons')
+    lines.append('')
+
+  for filename, lines in ((HEADER, header), (SOURCE, source)):
+    with open(os.path.join(ROOT, filename), 'w') as fp:
+      fp.write('\n'.join(lines))
+    print('Wrote {}'.format(filename))
+
+
+if __name__ == '__main__':
+  sys.exit(main())